@@ -79,6 +79,74 @@ static void bench_text_io_buf(benchmark::State& state, ExtraArgs&&... extra_args
   }
 }
 
+// A decision service event with a shared context and num_actions actions which have num_features features each.
+std::string get_dsjson_cb_event(size_t num_actions, size_t num_features)
+{
+  std::stringstream ss;
+  ss << R"({"_label_cost":-1,"_label_probability":0.5,"_label_Action":1,"_labelIndex":0,"o":[{"v":1,"EventId":"e1",)"
+     << R"("ActionTaken":false}],"Timestamp":"2023-01-01T00:00:00.0000000Z","Version":"1","EventId":"e1","a":[)";
+  for (size_t i = 0; i < num_actions; i++) { ss << (i == 0 ? "" : ",") << i + 1; }
+  ss << R"(],"c":{"shared":{"user":"u1","s_1":1,"s_2":0.5},"_multi":[)";
+  for (size_t i = 0; i < num_actions; i++)
+  {
+    ss << (i == 0 ? "" : ",") << R"({"action":{"id":"a)" << i << R"(")";
+    for (size_t j = 0; j < num_features; j++) { ss << R"(,"f)" << j << R"(":)" << j + 0.5f; }
+    ss << "}}";
+  }
+  ss << R"(]},"p":[)";
+  for (size_t i = 0; i < num_actions; i++) { ss << (i == 0 ? "" : ",") << 1.f / num_actions; }
+  ss << "],\"VWState\":{\"m\":\"N/A\"}}\n";
+  return ss.str();
+}
+
+// The same event as get_dsjson_cb_event in the text format.
+std::string get_text_cb_event(size_t num_actions, size_t num_features)
+{
+  std::stringstream ss;
+  ss << "shared |shared user=u1 s_1:1 s_2:0.5\n";
+  for (size_t i = 0; i < num_actions; i++)
+  {
+    if (i == 0) { ss << "1:-1:0.5 "; }
+    ss << "|action id=a" << i;
+    for (size_t j = 0; j < num_features; j++) { ss << " f" << j << ":" << j + 0.5f; }
+    ss << "\n";
+  }
+  ss << "\n";
+  return ss.str();
+}
+
+// Parses whole multiline examples, including the empty example which ends each of them.
+template <class... ExtraArgs>
+static void bench_multiline_io_buf(benchmark::State& state, ExtraArgs&&... extra_args)
+{
+  std::array<std::string, sizeof...(extra_args)> res = {extra_args...};
+  auto example_string = res[0];
+  std::vector<std::string> args = {"--cb_explore_adf", "--quiet"};
+  if (res.size() > 1) { args.push_back(res[1]); }
+
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  io_buf buffer;
+  buffer.add_file(VW::io::create_buffer_view(example_string.data(), example_string.size()));
+  VW::multi_ex examples;
+  VW::multi_ex parsed;
+
+  for (auto _ : state)
+  {
+    // The text reader fills one example per call while the dsjson reader returns a whole event.
+    int result = 0;
+    do {
+      parsed.push_back(&VW::get_unused_example(vw.get()));
+      result = vw->parser_runtime.example_parser->reader(vw.get(), buffer, parsed);
+      examples.insert(examples.end(), parsed.begin(), parsed.end());
+      parsed.clear();
+    } while (result != 0);
+    VW::finish_example(*vw, examples);
+    examples.clear();
+    buffer.reset();
+    benchmark::ClobberMemory();
+  }
+}
+
 static void benchmark_example_reuse(benchmark::State& state)
 {
   std::string example_string =
@@ -108,3 +176,6 @@ BENCHMARK_CAPTURE(bench_cache_io_buf, 120_num_fts, get_x_numerical_fts(120));
 BENCHMARK_CAPTURE(bench_text_io_buf, 120_num_fts, get_x_numerical_fts(120));
 
 BENCHMARK(benchmark_example_reuse);
+
+BENCHMARK_CAPTURE(bench_multiline_io_buf, dsjson_cb_10_actions_20_fts, get_dsjson_cb_event(10, 20), "--dsjson");
+BENCHMARK_CAPTURE(bench_multiline_io_buf, text_cb_10_actions_20_fts, get_text_cb_event(10, 20));
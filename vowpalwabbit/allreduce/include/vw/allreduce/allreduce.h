@@ -34,6 +34,7 @@ class promise;
 #  include <netdb.h>
 #  include <netinet/in.h>
 #  include <netinet/tcp.h>
+#  include <poll.h>
 #  include <sys/socket.h>
 #  include <unistd.h>
 
@@ -53,6 +54,7 @@ using socket_t = int;
 #include "vw/io/logger.h"
 
 #include <cassert>
+#include <vector>
 
 #ifdef _M_CEE
 #  pragma managed(push, off)
@@ -71,6 +73,8 @@ namespace VW
 namespace details
 {
 constexpr size_t AR_BUF_SIZE = 1 << 16;
+// Payloads smaller than this many bytes per node are latency bound, so the ring falls back to the tree.
+constexpr size_t AR_RING_MIN_SEGMENT_SIZE = 1 << 12;
 class node_socks
 {
 public:
@@ -95,6 +99,15 @@ void addbufs(T* buf1, const T* buf2, const size_t n)
   for (size_t i = 0; i < n; i++) { f(buf1[i], buf2[i]); }
 }
 
+// Type erased form of addbufs so that the socket code does not need to be a template.
+using combine_bytes_func = void (*)(char* buf1, const char* buf2, size_t num_bytes);
+
+template <class T, void (*f)(T&, const T&)>
+void combine_bytes(char* buf1, const char* buf2, size_t num_bytes)
+{
+  addbufs<T, f>(reinterpret_cast<T*>(buf1), reinterpret_cast<const T*>(buf2), num_bytes / sizeof(T));
+}
+
 }  // namespace details
 
 class all_reduce_base
@@ -220,13 +233,17 @@ public:
     broadcast((char*)buffer, n * sizeof(T));
   }
 
-private:
+protected:
   details::node_socks _socks;
   std::string _span_server;
-  int _port;
-  size_t _unique_id;  // unique id for each node in the network, id == 0 means extra io.
 
   void all_reduce_init(VW::io::logger& logger);
+  socket_t sock_connect(uint32_t ip, int port, VW::io::logger& logger);
+  socket_t getsock(VW::io::logger& logger);
+
+private:
+  int _port;
+  size_t _unique_id;  // unique id for each node in the network, id == 0 means extra io.
 
   template <class T>
   void pass_up(char* buffer, size_t left_read_pos, size_t right_read_pos, size_t& parent_sent_pos)
@@ -313,9 +330,45 @@ private:
 
   void pass_down(char* buffer, size_t parent_read_pos, size_t& children_sent_pos);
   void broadcast(char* buffer, size_t n);
+};
 
-  socket_t sock_connect(uint32_t ip, int port, VW::io::logger& logger);
-  socket_t getsock(VW::io::logger& logger);
+// Bandwidth optimal allreduce. The nodes are connected in a ring and the buffer is split into one segment per node.
+// A reduce-scatter leaves every node with one fully reduced segment and an all-gather then passes those around the
+// ring, so every link carries 2 * (total - 1) / total of the buffer regardless of the number of nodes. Segments are
+// streamed in AR_BUF_SIZE chunks over non-blocking sockets and received chunks are reduced while the next ones are in
+// flight. The spanning tree is still used to set up the ring and for payloads too small to benefit from it.
+class all_reduce_ring_sockets : public all_reduce_sockets
+{
+public:
+  all_reduce_ring_sockets(std::string pspan_server, const int pport, const size_t punique_id, size_t ptotal,
+      const size_t pnode, bool pquiet)
+      : all_reduce_sockets(std::move(pspan_server), pport, punique_id, ptotal, pnode, pquiet)
+  {
+  }
+
+  ~all_reduce_ring_sockets() override;
+
+  template <class T, void (*f)(T&, const T&)>
+  void all_reduce(T* buffer, const size_t n, VW::io::logger& logger)
+  {
+    if (total == 1 || n * sizeof(T) < total * details::AR_RING_MIN_SEGMENT_SIZE)
+    {
+      all_reduce_sockets::all_reduce<T, f>(buffer, n, logger);
+      return;
+    }
+    if (_next == -1) { ring_init(logger); }
+    ring_all_reduce(reinterpret_cast<char*>(buffer), n, sizeof(T), details::combine_bytes<T, f>);
+  }
+
+private:
+  socket_t _next = -1;  // Connection to node + 1, segments are sent here.
+  socket_t _prev = -1;  // Connection from node - 1, segments are received here.
+  std::vector<char> _staging;
+
+  void ring_init(VW::io::logger& logger);
+  void ring_all_reduce(char* buffer, size_t n, size_t element_size, details::combine_bytes_func combine);
+  void exchange(const char* send_buf, size_t send_size, char* recv_buf, size_t recv_size, size_t element_size,
+      details::combine_bytes_func combine);
 };
 
 }  // namespace VW
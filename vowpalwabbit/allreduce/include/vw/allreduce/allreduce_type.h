@@ -9,6 +9,7 @@ namespace VW
 enum class all_reduce_type
 {
   SOCKET,
-  THREAD
+  THREAD,
+  SOCKET_RING
 };
 }  // namespace VW
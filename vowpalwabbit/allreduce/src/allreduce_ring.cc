@@ -0,0 +1,196 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/allreduce/allreduce.h"
+#include "vw/common/vw_exception.h"
+#include "vw/io/logger.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+#  define VW_POLL WSAPoll
+#else
+#  include <fcntl.h>
+#  define VW_POLL poll
+#endif
+
+namespace
+{
+// A node which dies mid exchange must surface as an error from send, not kill this process with SIGPIPE.
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+void add_endpoint(uint64_t& a, const uint64_t& b) { a += b; }
+
+bool would_block()
+{
+#ifdef _WIN32
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+void set_non_blocking(socket_t sock)
+{
+#ifdef _WIN32
+  u_long mode = 1;
+  if (ioctlsocket(sock, FIONBIO, &mode) != 0) THROWERRNO("ioctlsocket");
+#else
+  int flags = fcntl(sock, F_GETFL, 0);
+  if (flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1) THROWERRNO("fcntl");
+#endif
+  int on = 1;
+  setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&on), sizeof(on));
+#ifdef SO_NOSIGPIPE
+  setsockopt(sock, SOL_SOCKET, SO_NOSIGPIPE, reinterpret_cast<char*>(&on), sizeof(on));
+#endif
+}
+
+uint32_t local_address(socket_t sock)
+{
+  sockaddr_in address;
+  socklen_t size = sizeof(address);
+  if (getsockname(sock, reinterpret_cast<sockaddr*>(&address), &size) < 0) THROWERRNO("getsockname");
+  return address.sin_addr.s_addr;
+}
+}  // namespace
+
+VW::all_reduce_ring_sockets::~all_reduce_ring_sockets()
+{
+  if (_next != -1) { CLOSESOCK(_next); }
+  if (_prev != -1) { CLOSESOCK(_prev); }
+}
+
+void VW::all_reduce_ring_sockets::ring_init(VW::io::logger& logger)
+{
+  socket_t listener = getsock(logger);
+  sockaddr_in address;
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = 0;
+  if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) THROWERRNO("bind");
+  if (listen(listener, 1) < 0) THROWERRNO("listen");
+  socklen_t size = sizeof(address);
+  if (getsockname(listener, reinterpret_cast<sockaddr*>(&address), &size) < 0) THROWERRNO("getsockname");
+
+  // Every node publishes the address it listens on through the spanning tree. The local address is the one its tree
+  // connections use.
+  if (_span_server != _socks.current_master) { all_reduce_init(logger); }
+  const socket_t tree_sock = _socks.parent != -1 ? _socks.parent : _socks.children[0];
+  std::vector<uint64_t> endpoints(total, 0);
+  endpoints[node] = (static_cast<uint64_t>(local_address(tree_sock)) << 16) | address.sin_port;
+  all_reduce_sockets::all_reduce<uint64_t, add_endpoint>(endpoints.data(), total, logger);
+
+  // Connecting first cannot deadlock because every node is already listening.
+  const uint64_t next_endpoint = endpoints[(node + 1) % total];
+  _next = sock_connect(static_cast<uint32_t>(next_endpoint >> 16), static_cast<int>(next_endpoint & 0xffff), logger);
+
+  sockaddr_in prev_address;
+  socklen_t prev_size = sizeof(prev_address);
+  _prev = accept(listener, reinterpret_cast<sockaddr*>(&prev_address), &prev_size);
+#ifdef _WIN32
+  if (_prev == INVALID_SOCKET)
+#else
+  if (_prev < 0)
+#endif
+    THROWERRNO("accept");
+  CLOSESOCK(listener);
+
+  set_non_blocking(_next);
+  set_non_blocking(_prev);
+}
+
+void VW::all_reduce_ring_sockets::ring_all_reduce(
+    char* buffer, size_t n, size_t element_size, details::combine_bytes_func combine)
+{
+  if (_staging.size() < details::AR_BUF_SIZE + element_size) { _staging.resize(details::AR_BUF_SIZE + element_size); }
+
+  // Segment i covers elements [n * i / total, n * (i + 1) / total).
+  auto segment_begin = [&](size_t i) { return buffer + n * i / total * element_size; };
+  auto segment_size = [&](size_t i) { return static_cast<size_t>(segment_begin(i + 1) - segment_begin(i)); };
+
+  // Reduce-scatter: after total - 1 steps this node holds the fully reduced segment node + 1.
+  for (size_t step = 0; step + 1 < total; step++)
+  {
+    const size_t send_segment = (node + total - step) % total;
+    const size_t recv_segment = (node + 2 * total - step - 1) % total;
+    exchange(segment_begin(send_segment), segment_size(send_segment), segment_begin(recv_segment),
+        segment_size(recv_segment), element_size, combine);
+  }
+
+  // All-gather: pass the reduced segments around the ring.
+  for (size_t step = 0; step + 1 < total; step++)
+  {
+    const size_t send_segment = (node + 1 + total - step) % total;
+    const size_t recv_segment = (node + total - step) % total;
+    exchange(segment_begin(send_segment), segment_size(send_segment), segment_begin(recv_segment),
+        segment_size(recv_segment), element_size, nullptr);
+  }
+}
+
+void VW::all_reduce_ring_sockets::exchange(const char* send_buf, size_t send_size, char* recv_buf, size_t recv_size,
+    size_t element_size, details::combine_bytes_func combine)
+{
+  size_t sent = 0;
+  size_t received = 0;
+  size_t staged = 0;  // Bytes of a partially received element at the front of _staging.
+
+  while (sent < send_size || received < recv_size)
+  {
+    pollfd fds[2];
+    fds[0].fd = _next;
+    fds[0].events = sent < send_size ? POLLOUT : 0;
+    fds[0].revents = 0;
+    fds[1].fd = _prev;
+    fds[1].events = received < recv_size ? POLLIN : 0;
+    fds[1].revents = 0;
+    if (VW_POLL(fds, 2, -1) < 0)
+    {
+      if (would_block()) { continue; }
+      THROWERRNO("poll");
+    }
+
+    if (sent < send_size && (fds[0].revents & (POLLOUT | POLLERR | POLLHUP)) != 0)
+    {
+      const size_t count = std::min(details::AR_BUF_SIZE, send_size - sent);
+      const auto write_size = send(_next, send_buf + sent, static_cast<int>(count), SEND_FLAGS);
+      if (write_size < 0)
+      {
+        if (!would_block()) THROWERRNO("send to next ring node");
+      }
+      else { sent += static_cast<size_t>(write_size); }
+    }
+
+    if (received < recv_size && (fds[1].revents & (POLLIN | POLLERR | POLLHUP)) != 0)
+    {
+      const size_t count = std::min(details::AR_BUF_SIZE, recv_size - received);
+      char* destination = combine == nullptr ? recv_buf + received : _staging.data() + staged;
+      const auto read_size = recv(_prev, destination, static_cast<int>(count), 0);
+      if (read_size == 0) { THROW("Previous ring node closed the connection"); }
+      if (read_size < 0)
+      {
+        if (!would_block()) THROWERRNO("recv from previous ring node");
+        continue;
+      }
+
+      if (combine != nullptr)
+      {
+        // Reduce the whole elements received so far while the next chunk is in flight.
+        const size_t available = staged + static_cast<size_t>(read_size);
+        const size_t whole = available / element_size * element_size;
+        combine(recv_buf + received - staged, _staging.data(), whole);
+        staged = available - whole;
+        std::memmove(_staging.data(), _staging.data() + whole, staged);
+      }
+      received += static_cast<size_t>(read_size);
+    }
+  }
+}
@@ -0,0 +1,159 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/cache_parser/parse_example_cache.h"
+#include "vw/common/random.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/multi_ex.h"
+#include "vw/core/thread_pool.h"
+#include "vw/core/vw_fwd.h"
+#include "vw/io/io_adapter.h"
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace VW
+{
+namespace parsers
+{
+namespace cache
+{
+// Block cache files (--cache_format v2) are laid out as follows, integers are little endian:
+//   header: BLOCK_CACHE_MAGIC, schema version, num_bits, codec and uncompressed block size, all uint32_t
+//   blocks: a block_header followed by its compressed payload. A payload decompresses to whole examples in the record
+//     format of write_example_to_cache. A block_header with no examples ends the blocks, its compressed_size is the
+//     number of bytes of index and footer which follow it.
+//   index: one block_index_entry per block
+//   footer: a block_cache_footer
+// Unlike the version 1 cache the format does not depend on the VW version that wrote it, only on the schema version.
+constexpr char BLOCK_CACHE_MAGIC[8] = {'V', 'W', 'C', 'A', 'C', 'H', 'E', '2'};
+constexpr uint32_t BLOCK_CACHE_SCHEMA_VERSION = 1;
+constexpr uint32_t BLOCK_CACHE_CODEC_ZLIB = 1;
+constexpr size_t DEFAULT_BLOCK_CACHE_BLOCK_SIZE = 1 << 20;
+constexpr size_t DEFAULT_SHUFFLE_WINDOW_BLOCKS = 16;
+
+class block_header
+{
+public:
+  uint32_t num_examples;
+  uint32_t uncompressed_size;
+  uint32_t compressed_size;
+  uint32_t checksum;  // crc32 of the uncompressed payload
+};
+
+class block_index_entry
+{
+public:
+  uint64_t offset;  // of the block_header from the start of the file
+  uint64_t first_example;
+  uint32_t num_examples;
+  uint32_t compressed_size;
+};
+
+class block_cache_footer
+{
+public:
+  uint64_t index_offset;
+  uint64_t num_blocks;
+  uint64_t num_examples;
+  uint32_t index_checksum;  // crc32 of the index
+  uint32_t schema_version;
+  char magic[8];
+};
+
+namespace details
+{
+// One example of a decoded block, in the record format of write_example_to_cache.
+class block_cache_record
+{
+public:
+  std::shared_ptr<std::vector<char>> block;
+  size_t offset;
+  size_t size;
+};
+}  // namespace details
+
+// Collects examples into blocks and writes them, compressed, to an output that starts with write_header.
+class block_cache_writer
+{
+public:
+  explicit block_cache_writer(size_t block_size = DEFAULT_BLOCK_CACHE_BLOCK_SIZE);
+
+  void write_header(io_buf& output, uint32_t num_bits);
+  void write_example(io_buf& output, VW::example& ex, VW::label_parser& lbl_parser, uint64_t parse_mask);
+  // Writes the last partial block, the index and the footer. Nothing can be written afterwards.
+  void finish(io_buf& output);
+
+private:
+  void write_block(io_buf& output);
+
+  size_t _block_size;
+  details::cache_temp_buffer _example_buffer;
+  details::cache_temp_buffer _block;
+  uint32_t _block_examples = 0;
+  std::vector<char> _compressed;
+  std::vector<block_index_entry> _index;
+  uint64_t _offset = 0;
+  uint64_t _num_examples = 0;
+};
+
+// Reads the examples of block caches from an input which has been positioned after the header of each file by
+// read_block_cache_header. Blocks are read ahead and decoded on decode_threads threads while earlier ones are parsed.
+class block_cache_reader
+{
+public:
+  explicit block_cache_reader(size_t decode_threads);
+
+  // Same contract as read_example_from_cache.
+  int read_example(VW::workspace* all, io_buf& input, VW::multi_ex& examples);
+  // Drops blocks read ahead, required when the input is reset.
+  void reset();
+
+  // Instead of reading blocks from the input, every pass visits the blocks of file_names in a random order drawn from
+  // seed. The examples of window_blocks consecutive blocks are permuted together, which bounds the memory used.
+  void enable_shuffle(std::vector<std::string> file_names, uint64_t seed, size_t window_blocks);
+
+private:
+  bool read_next_block(io_buf& input);
+  int read_shuffled_example(VW::workspace* all, VW::multi_ex& examples);
+  void fill_shuffle_window();
+
+  VW::thread_pool _pool;
+  size_t _max_in_flight;
+  std::deque<std::future<std::shared_ptr<std::vector<char>>>> _in_flight;
+  std::shared_ptr<std::vector<char>> _current_block;
+  std::unique_ptr<io_buf> _current;
+  bool _input_done = false;
+
+  std::vector<std::string> _shuffle_files;
+  // Blocks of all shuffled files as the index of their file and their index entry, in the order of the current pass.
+  std::vector<std::pair<size_t, block_index_entry>> _shuffle_blocks;
+  size_t _next_shuffle_block = 0;
+  bool _shuffle_order_drawn = false;
+  size_t _shuffle_window_blocks = DEFAULT_SHUFFLE_WINDOW_BLOCKS;
+  std::vector<details::block_cache_record> _shuffle_window;
+  size_t _next_shuffle_record = 0;
+  VW::rand_state _shuffle_random;
+};
+
+bool is_block_cache_magic(const char* data, size_t size);
+// Reads the rest of the header after the magic and returns the number of bits the cache was written with.
+uint32_t read_block_cache_header(VW::io::reader& reader);
+// Reader of the parser for block caches, keeps its state in the parser.
+int read_example_from_block_cache(VW::workspace* all, io_buf& input, VW::multi_ex& examples);
+
+// Random access to a block cache file, for example to split it into shards on block boundaries.
+std::vector<block_index_entry> read_block_cache_index(const std::string& file_name);
+// Returns the decompressed payload of one block which read_example_from_cache can read example by example.
+std::vector<char> read_block_cache_block(const std::string& file_name, const block_index_entry& entry);
+}  // namespace cache
+}  // namespace parsers
+}  // namespace VW
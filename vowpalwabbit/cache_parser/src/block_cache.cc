@@ -0,0 +1,365 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/cache_parser/block_cache.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/memory.h"
+#include "vw/core/parser.h"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+namespace
+{
+uint32_t checksum(const char* data, size_t size)
+{
+  return static_cast<uint32_t>(crc32(0L, reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size)));
+}
+
+std::vector<char> decode_block(const VW::parsers::cache::block_header& header, const std::vector<char>& payload)
+{
+  std::vector<char> decoded(header.uncompressed_size);
+  uLongf decoded_size = header.uncompressed_size;
+  if (uncompress(reinterpret_cast<Bytef*>(decoded.data()), &decoded_size,
+          reinterpret_cast<const Bytef*>(payload.data()), static_cast<uLong>(payload.size())) != Z_OK ||
+      decoded_size != header.uncompressed_size)
+  {
+    THROW("Failed to decompress block of cache file. File may be corrupt.");
+  }
+  if (checksum(decoded.data(), decoded.size()) != header.checksum)
+  {
+    THROW("Checksum mismatch in block of cache file. File is corrupt.");
+  }
+  return decoded;
+}
+
+// Fisher-Yates shuffle driven by the given random state.
+template <typename T>
+void shuffle(std::vector<T>& items, VW::rand_state& random)
+{
+  for (size_t i = items.size(); i > 1; i--)
+  {
+    auto j = static_cast<size_t>(random.get_and_update_random() * static_cast<float>(i));
+    if (j >= i) { j = i - 1; }
+    std::swap(items[i - 1], items[j]);
+  }
+}
+
+void read_exactly(std::ifstream& file, char* data, size_t size, const std::string& file_name)
+{
+  file.read(data, static_cast<std::streamsize>(size));
+  if (!file || static_cast<size_t>(file.gcount()) != size)
+  {
+    THROW("Failed to read from cache file: " << file_name << ". File may be truncated.");
+  }
+}
+}  // namespace
+
+VW::parsers::cache::block_cache_writer::block_cache_writer(size_t block_size) : _block_size(block_size)
+{
+  if (_block_size == 0 || _block_size > std::numeric_limits<uint32_t>::max())
+  {
+    THROW("Block size of a cache file must be positive and fit in 32 bits, got: " << _block_size);
+  }
+}
+
+void VW::parsers::cache::block_cache_writer::write_header(io_buf& output, uint32_t num_bits)
+{
+  output.bin_write_fixed(BLOCK_CACHE_MAGIC, sizeof(BLOCK_CACHE_MAGIC));
+  output.write_value<uint32_t>(BLOCK_CACHE_SCHEMA_VERSION);
+  output.write_value<uint32_t>(num_bits);
+  output.write_value<uint32_t>(BLOCK_CACHE_CODEC_ZLIB);
+  output.write_value<uint32_t>(static_cast<uint32_t>(_block_size));
+  _offset = sizeof(BLOCK_CACHE_MAGIC) + 4 * sizeof(uint32_t);
+}
+
+void VW::parsers::cache::block_cache_writer::write_example(
+    io_buf& output, VW::example& ex, VW::label_parser& lbl_parser, uint64_t parse_mask)
+{
+  write_example_to_cache(_block.temporary_cache_buffer, &ex, lbl_parser, parse_mask, _example_buffer);
+  _block.temporary_cache_buffer.flush();
+  _block_examples++;
+  if (_block.backing_buffer->size() >= _block_size) { write_block(output); }
+}
+
+void VW::parsers::cache::block_cache_writer::write_block(io_buf& output)
+{
+  if (_block_examples == 0) { return; }
+
+  const auto& data = *_block.backing_buffer;
+  if (data.size() > std::numeric_limits<uint32_t>::max())
+  {
+    THROW("Example of size " << data.size() << " is too large for a cache block");
+  }
+
+  uLongf compressed_size = compressBound(static_cast<uLong>(data.size()));
+  _compressed.resize(compressed_size);
+  if (compress2(reinterpret_cast<Bytef*>(_compressed.data()), &compressed_size,
+          reinterpret_cast<const Bytef*>(data.data()), static_cast<uLong>(data.size()), Z_BEST_SPEED) != Z_OK)
+  {
+    THROW("Failed to compress block of cache file");
+  }
+
+  block_header header;
+  header.num_examples = _block_examples;
+  header.uncompressed_size = static_cast<uint32_t>(data.size());
+  header.compressed_size = static_cast<uint32_t>(compressed_size);
+  header.checksum = checksum(data.data(), data.size());
+  output.write_value(header);
+  output.bin_write_fixed(_compressed.data(), compressed_size);
+
+  block_index_entry entry;
+  entry.offset = _offset;
+  entry.first_example = _num_examples;
+  entry.num_examples = _block_examples;
+  entry.compressed_size = header.compressed_size;
+  _index.push_back(entry);
+
+  _offset += sizeof(block_header) + compressed_size;
+  _num_examples += _block_examples;
+  _block_examples = 0;
+  _block.backing_buffer->clear();
+}
+
+void VW::parsers::cache::block_cache_writer::finish(io_buf& output)
+{
+  write_block(output);
+
+  const size_t index_size = _index.size() * sizeof(block_index_entry);
+  block_header terminator;
+  terminator.num_examples = 0;
+  terminator.uncompressed_size = 0;
+  terminator.compressed_size = static_cast<uint32_t>(index_size + sizeof(block_cache_footer));
+  terminator.checksum = 0;
+  output.write_value(terminator);
+
+  block_cache_footer footer;
+  footer.index_offset = _offset + sizeof(block_header);
+  footer.num_blocks = _index.size();
+  footer.num_examples = _num_examples;
+  footer.index_checksum = checksum(reinterpret_cast<const char*>(_index.data()), index_size);
+  footer.schema_version = BLOCK_CACHE_SCHEMA_VERSION;
+  std::memcpy(footer.magic, BLOCK_CACHE_MAGIC, sizeof(BLOCK_CACHE_MAGIC));
+  output.bin_write_fixed(reinterpret_cast<const char*>(_index.data()), index_size);
+  output.write_value(footer);
+
+  _offset = footer.index_offset + index_size + sizeof(block_cache_footer);
+  _index.clear();
+}
+
+VW::parsers::cache::block_cache_reader::block_cache_reader(size_t decode_threads)
+    // A single thread decodes on the calling thread, when the block is needed.
+    : _pool(decode_threads > 1 ? decode_threads : 0), _max_in_flight(decode_threads > 1 ? 2 * decode_threads : 1)
+{
+}
+
+bool VW::parsers::cache::block_cache_reader::read_next_block(io_buf& input)
+{
+  while (true)
+  {
+    char* read_head = nullptr;
+    const size_t header_bytes = input.buf_read(read_head, sizeof(block_header));
+    if (header_bytes == 0) { return false; }
+    if (header_bytes < sizeof(block_header)) { THROW("Ran out of cache while reading block. File may be truncated."); }
+    block_header header;
+    std::memcpy(&header, read_head, sizeof(block_header));
+
+    if (header.compressed_size > 0 && input.buf_read(read_head, header.compressed_size) < header.compressed_size)
+    {
+      THROW("Ran out of cache while reading block. File may be truncated.");
+    }
+    // The index and footer of a file are skipped, the blocks of the next input file follow them.
+    if (header.num_examples == 0) { continue; }
+
+    auto payload = std::make_shared<std::vector<char>>(read_head, read_head + header.compressed_size);
+    _in_flight.push_back(_pool.submit(
+        [header, payload]() { return std::make_shared<std::vector<char>>(decode_block(header, *payload)); }));
+    return true;
+  }
+}
+
+int VW::parsers::cache::block_cache_reader::read_example(VW::workspace* all, io_buf& input, VW::multi_ex& examples)
+{
+  if (!_shuffle_files.empty()) { return read_shuffled_example(all, examples); }
+
+  while (true)
+  {
+    if (_current != nullptr)
+    {
+      const int bytes = read_example_from_cache(all, *_current, examples);
+      if (bytes > 0) { return bytes; }
+    }
+
+    while (!_input_done && _in_flight.size() < _max_in_flight)
+    {
+      if (!read_next_block(input)) { _input_done = true; }
+    }
+    if (_in_flight.empty()) { return 0; }
+
+    _current_block = _in_flight.front().get();
+    _in_flight.pop_front();
+    _current = VW::make_unique<io_buf>();
+    _current->add_file(VW::io::create_buffer_view(_current_block->data(), _current_block->size()));
+  }
+}
+
+void VW::parsers::cache::block_cache_reader::reset()
+{
+  // Blocks still being decoded own their data, so the futures can be dropped without waiting for them.
+  _in_flight.clear();
+  _current.reset();
+  _current_block.reset();
+  _input_done = false;
+  _shuffle_order_drawn = false;
+  _shuffle_window.clear();
+  _next_shuffle_record = 0;
+}
+
+void VW::parsers::cache::block_cache_reader::enable_shuffle(
+    std::vector<std::string> file_names, uint64_t seed, size_t window_blocks)
+{
+  if (window_blocks == 0) { THROW("The shuffle window must hold at least one block"); }
+  reset();
+  _shuffle_files = std::move(file_names);
+  _shuffle_blocks.clear();
+  for (size_t i = 0; i < _shuffle_files.size(); i++)
+  {
+    for (const auto& entry : read_block_cache_index(_shuffle_files[i])) { _shuffle_blocks.emplace_back(i, entry); }
+  }
+  _shuffle_window_blocks = window_blocks;
+  _shuffle_random.set_random_state(seed);
+}
+
+int VW::parsers::cache::block_cache_reader::read_shuffled_example(VW::workspace* all, VW::multi_ex& examples)
+{
+  if (!_shuffle_order_drawn)
+  {
+    shuffle(_shuffle_blocks, _shuffle_random);
+    _next_shuffle_block = 0;
+    _shuffle_order_drawn = true;
+  }
+  if (_next_shuffle_record == _shuffle_window.size())
+  {
+    fill_shuffle_window();
+    if (_shuffle_window.empty()) { return 0; }
+  }
+
+  const auto& record = _shuffle_window[_next_shuffle_record++];
+  _current_block = record.block;
+  if (_current == nullptr) { _current = VW::make_unique<io_buf>(); }
+  _current->close_files();
+  _current->reset();
+  _current->add_file(VW::io::create_buffer_view(record.block->data() + record.offset, record.size));
+  return read_example_from_cache(all, *_current, examples);
+}
+
+void VW::parsers::cache::block_cache_reader::fill_shuffle_window()
+{
+  _shuffle_window.clear();
+  _next_shuffle_record = 0;
+  for (size_t taken = 0; taken < _shuffle_window_blocks; taken++)
+  {
+    while (_in_flight.size() < _max_in_flight && _next_shuffle_block < _shuffle_blocks.size())
+    {
+      const auto& file_name = _shuffle_files[_shuffle_blocks[_next_shuffle_block].first];
+      const auto entry = _shuffle_blocks[_next_shuffle_block].second;
+      _next_shuffle_block++;
+      _in_flight.push_back(_pool.submit([file_name, entry]()
+          { return std::make_shared<std::vector<char>>(read_block_cache_block(file_name, entry)); }));
+    }
+    if (_in_flight.empty()) { break; }
+
+    auto block = _in_flight.front().get();
+    _in_flight.pop_front();
+    size_t offset = 0;
+    while (offset < block->size())
+    {
+      uint64_t example_size = 0;
+      if (block->size() - offset < sizeof(example_size)) { THROW("Block of cache file ends in a truncated example"); }
+      std::memcpy(&example_size, block->data() + offset, sizeof(example_size));
+      const size_t record_size = sizeof(example_size) + example_size;
+      if (block->size() - offset < record_size) { THROW("Block of cache file ends in a truncated example"); }
+      _shuffle_window.push_back({block, offset, record_size});
+      offset += record_size;
+    }
+  }
+  shuffle(_shuffle_window, _shuffle_random);
+}
+
+bool VW::parsers::cache::is_block_cache_magic(const char* data, size_t size)
+{
+  return size >= sizeof(BLOCK_CACHE_MAGIC) && std::memcmp(data, BLOCK_CACHE_MAGIC, sizeof(BLOCK_CACHE_MAGIC)) == 0;
+}
+
+uint32_t VW::parsers::cache::read_block_cache_header(VW::io::reader& reader)
+{
+  uint32_t fields[4];
+  if (static_cast<size_t>(reader.read(reinterpret_cast<char*>(fields), sizeof(fields))) < sizeof(fields))
+  {
+    THROW("failed to read: cache header");
+  }
+  if (fields[0] != BLOCK_CACHE_SCHEMA_VERSION)
+  {
+    THROW("Cache file schema version " << fields[0] << " is not supported, expected " << BLOCK_CACHE_SCHEMA_VERSION);
+  }
+  if (fields[2] != BLOCK_CACHE_CODEC_ZLIB) { THROW("Cache file uses unknown codec: " << fields[2]); }
+  return fields[1];
+}
+
+int VW::parsers::cache::read_example_from_block_cache(VW::workspace* all, io_buf& input, VW::multi_ex& examples)
+{
+  assert(all != nullptr);
+  assert(all->parser_runtime.example_parser->block_cache_reader != nullptr);
+  return all->parser_runtime.example_parser->block_cache_reader->read_example(all, input, examples);
+}
+
+std::vector<VW::parsers::cache::block_index_entry> VW::parsers::cache::read_block_cache_index(
+    const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file) { THROW("Could not open cache file: " << file_name); }
+
+  block_cache_footer footer;
+  file.seekg(-static_cast<std::streamoff>(sizeof(block_cache_footer)), std::ios::end);
+  read_exactly(file, reinterpret_cast<char*>(&footer), sizeof(footer), file_name);
+  if (!is_block_cache_magic(footer.magic, sizeof(footer.magic)) || footer.schema_version != BLOCK_CACHE_SCHEMA_VERSION)
+  {
+    THROW("Cache file " << file_name << " has no block index. It may be truncated or not be a v2 cache file.");
+  }
+
+  std::vector<block_index_entry> index(static_cast<size_t>(footer.num_blocks));
+  file.seekg(static_cast<std::streamoff>(footer.index_offset));
+  const size_t index_size = index.size() * sizeof(block_index_entry);
+  read_exactly(file, reinterpret_cast<char*>(index.data()), index_size, file_name);
+  if (checksum(reinterpret_cast<const char*>(index.data()), index_size) != footer.index_checksum)
+  {
+    THROW("Checksum mismatch in index of cache file: " << file_name);
+  }
+  return index;
+}
+
+std::vector<char> VW::parsers::cache::read_block_cache_block(
+    const std::string& file_name, const block_index_entry& entry)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file) { THROW("Could not open cache file: " << file_name); }
+
+  block_header header;
+  file.seekg(static_cast<std::streamoff>(entry.offset));
+  read_exactly(file, reinterpret_cast<char*>(&header), sizeof(header), file_name);
+  if (header.num_examples != entry.num_examples || header.compressed_size != entry.compressed_size)
+  {
+    THROW("Block at offset " << entry.offset << " of cache file " << file_name << " does not match its index entry");
+  }
+  std::vector<char> payload(header.compressed_size);
+  read_exactly(file, payload.data(), payload.size(), file_name);
+  return decode_block(header, payload);
+}
@@ -2,7 +2,9 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/cache_parser/block_cache.h"
 #include "vw/cache_parser/parse_example_cache.h"
+#include "vw/common/vw_exception.h"
 #include "vw/core/vw.h"
 #include "vw/core/vw_fwd.h"
 #include "vw/test_common/test_common.h"
@@ -11,6 +13,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
 #include <memory>
 
 using namespace ::testing;
@@ -175,3 +179,138 @@ TEST(Cache, WriteAndReadFeatures)
     EXPECT_FLOAT_EQ(it.value(), read_it.value());
   }
 }
+
+namespace
+{
+std::shared_ptr<std::vector<char>> write_block_cache(VW::workspace& workspace, size_t num_examples, size_t block_size)
+{
+  auto backing_vector = std::make_shared<std::vector<char>>();
+  VW::io_buf io_writer;
+  io_writer.add_file(VW::io::create_vector_writer(backing_vector));
+
+  VW::parsers::cache::block_cache_writer writer(block_size);
+  writer.write_header(io_writer, workspace.initial_weights_config.num_bits);
+  for (size_t i = 0; i < num_examples; i++)
+  {
+    VW::example ex;
+    VW::parsers::text::read_line(workspace, &ex, std::to_string(i) + " |ns a b:0.5 c" + std::to_string(i));
+    writer.write_example(io_writer, ex, workspace.parser_runtime.example_parser->lbl_parser,
+        workspace.runtime_state.parse_mask);
+  }
+  writer.finish(io_writer);
+  io_writer.flush();
+  return backing_vector;
+}
+
+std::vector<float> read_block_cache_labels(VW::workspace& workspace, const std::vector<char>& data, size_t threads)
+{
+  auto reader = VW::io::create_buffer_view(data.data(), data.size());
+  char magic[sizeof(VW::parsers::cache::BLOCK_CACHE_MAGIC)];
+  reader->read(magic, sizeof(magic));
+  EXPECT_TRUE(VW::parsers::cache::is_block_cache_magic(magic, sizeof(magic)));
+  EXPECT_EQ(VW::parsers::cache::read_block_cache_header(*reader), workspace.initial_weights_config.num_bits);
+
+  VW::io_buf io_reader;
+  io_reader.add_file(std::move(reader));
+  VW::parsers::cache::block_cache_reader block_reader(threads);
+  std::vector<float> labels;
+  while (true)
+  {
+    VW::example ex;
+    VW::multi_ex examples{&ex};
+    if (block_reader.read_example(&workspace, io_reader, examples) == 0) { break; }
+    EXPECT_EQ(ex.feature_space['n'].size(), 3);
+    labels.push_back(ex.l.simple.label);
+  }
+  return labels;
+}
+}  // namespace
+
+TEST(Cache, WriteAndReadBlockCache)
+{
+  auto workspace = VW::initialize(vwtest::make_args("--quiet"));
+  // A small block size splits the examples over many blocks.
+  auto data = write_block_cache(*workspace, 100, 64);
+
+  std::vector<float> expected;
+  for (size_t i = 0; i < 100; i++) { expected.push_back(static_cast<float>(i)); }
+  EXPECT_THAT(read_block_cache_labels(*workspace, *data, 1), Pointwise(FloatEq(), expected));
+  EXPECT_THAT(read_block_cache_labels(*workspace, *data, 4), Pointwise(FloatEq(), expected));
+}
+
+TEST(Cache, BlockCacheIndexAndRandomAccess)
+{
+  auto workspace = VW::initialize(vwtest::make_args("--quiet"));
+  auto data = write_block_cache(*workspace, 100, 64);
+  const std::string file_name = "block_cache_index_test.cache";
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file.write(data->data(), static_cast<std::streamsize>(data->size()));
+  }
+
+  auto index = VW::parsers::cache::read_block_cache_index(file_name);
+  ASSERT_GT(index.size(), 1);
+  EXPECT_EQ(index.back().first_example + index.back().num_examples, 100);
+
+  // The last block can be read on its own, starting at its first example.
+  auto block = VW::parsers::cache::read_block_cache_block(file_name, index.back());
+  VW::io_buf io_reader;
+  io_reader.add_file(VW::io::create_buffer_view(block.data(), block.size()));
+  VW::example ex;
+  VW::multi_ex examples{&ex};
+  EXPECT_GT(VW::parsers::cache::read_example_from_cache(workspace.get(), io_reader, examples), 0);
+  EXPECT_FLOAT_EQ(ex.l.simple.label, static_cast<float>(index.back().first_example));
+  std::remove(file_name.c_str());
+}
+
+TEST(Cache, ShuffledBlockCacheVisitsEveryExampleOncePerPass)
+{
+  auto workspace = VW::initialize(vwtest::make_args("--quiet"));
+  auto data = write_block_cache(*workspace, 100, 64);
+  const std::string file_name = "block_cache_shuffle_test.cache";
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file.write(data->data(), static_cast<std::streamsize>(data->size()));
+  }
+
+  VW::parsers::cache::block_cache_reader block_reader(2);
+  block_reader.enable_shuffle({file_name}, 7, 2);
+  // The input is not read when shuffling.
+  VW::io_buf unused_input;
+  std::vector<std::vector<float>> passes;
+  for (size_t pass = 0; pass < 2; pass++)
+  {
+    std::vector<float> labels;
+    while (true)
+    {
+      VW::example ex;
+      VW::multi_ex examples{&ex};
+      if (block_reader.read_example(workspace.get(), unused_input, examples) == 0) { break; }
+      labels.push_back(ex.l.simple.label);
+    }
+    passes.push_back(labels);
+    block_reader.reset();
+  }
+  std::remove(file_name.c_str());
+
+  std::vector<float> expected;
+  for (size_t i = 0; i < 100; i++) { expected.push_back(static_cast<float>(i)); }
+  for (const auto& labels : passes)
+  {
+    EXPECT_THAT(labels, UnorderedPointwise(FloatEq(), expected));
+    EXPECT_THAT(labels, Not(Pointwise(FloatEq(), expected)));
+  }
+  EXPECT_THAT(passes[0], Not(Pointwise(FloatEq(), passes[1])));
+}
+
+TEST(Cache, CorruptBlockCacheThrows)
+{
+  auto workspace = VW::initialize(vwtest::make_args("--quiet"));
+  auto data = write_block_cache(*workspace, 10, 1 << 20);
+
+  // Flip a byte of the compressed payload of the only block, after the file and block headers.
+  const size_t payload_offset =
+      sizeof(VW::parsers::cache::BLOCK_CACHE_MAGIC) + 4 * sizeof(uint32_t) + sizeof(VW::parsers::cache::block_header);
+  (*data)[payload_offset + 4] ^= 0x55;
+  EXPECT_THROW(read_block_cache_labels(*workspace, *data, 1), VW::vw_exception);
+}
@@ -9,12 +9,17 @@
 #include "vw/core/learner.h"
 #include "vw/core/memory.h"
 #include "vw/core/parse_primitives.h"
+#include "vw/core/parser.h"
 #include "vw/core/scope_exit.h"
 #include "vw/core/vw.h"
 #include "vw/io/logger.h"
 
 #include <fstream>
 
+#ifdef VW_FEAT_NETWORKING_ENABLED
+#  include "vw/core/daemon_server.h"
+#endif
+
 using namespace VW::config;
 
 std::unique_ptr<VW::workspace> setup(std::unique_ptr<options_i> options)
@@ -96,24 +101,34 @@ int main(int argc, char* argv[])
       return 0;
     }
 
-    if (should_use_onethread)
+#ifdef VW_FEAT_NETWORKING_ENABLED
+    if (all.parser_runtime.example_parser->daemon_threads > 0)
     {
-      if (alls.size() == 1) { VW::LEARNER::generic_driver_onethread(all); }
-      else
-        THROW("--onethread doesn't make sense with multiple learners");
+      if (alls.size() != 1) THROW("--daemon_threads doesn't make sense with multiple learners");
+      VW::details::run_threaded_daemon(all);
     }
     else
+#endif
     {
-      VW::start_parser(all);
-      auto scope_guard = VW::scope_exit([&all] { VW::end_parser(all); });
-
-      if (alls.size() == 1) { VW::LEARNER::generic_driver(all); }
+      if (should_use_onethread)
+      {
+        if (alls.size() == 1) { VW::LEARNER::generic_driver_onethread(all); }
+        else
+          THROW("--onethread doesn't make sense with multiple learners");
+      }
       else
       {
-        std::vector<VW::workspace*> alls_ptrs;
-        alls_ptrs.reserve(alls.size());
-        for (auto& v : alls) { alls_ptrs.push_back(v.get()); }
-        VW::LEARNER::generic_driver(alls_ptrs);
+        VW::start_parser(all);
+        auto scope_guard = VW::scope_exit([&all] { VW::end_parser(all); });
+
+        if (alls.size() == 1) { VW::LEARNER::generic_driver(all); }
+        else
+        {
+          std::vector<VW::workspace*> alls_ptrs;
+          alls_ptrs.reserve(alls.size());
+          for (auto& v : alls) { alls_ptrs.push_back(v.get()); }
+          VW::LEARNER::generic_driver(alls_ptrs);
+        }
       }
     }
 
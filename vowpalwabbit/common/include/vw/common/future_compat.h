@@ -115,6 +115,13 @@
 #  define FORCE_INLINE
 #endif
 
+// Hints the CPU to start loading the cache line holding address. Has no effect where not supported.
+#if defined(__GNUC__) || defined(__clang__)
+#  define VW_PREFETCH(address) __builtin_prefetch(address)
+#else
+#  define VW_PREFETCH(address)
+#endif
+
 #ifdef VW_USE_ASAN
 #  if defined(_MSC_VER)
 #    define NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
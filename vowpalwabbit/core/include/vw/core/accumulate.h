@@ -5,15 +5,55 @@
 // This implements various accumulate functions building on top of allreduce.
 #pragma once
 
+#include "vw/common/string_view.h"
 #include "vw/core/vw_fwd.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace VW
 {
 namespace details
 {
+enum class all_reduce_compression
+{
+  NONE,
+  SPARSE,  // Only blocks that changed since the last sync are sent, as floats.
+  FP16,    // Changed blocks are sent as half precision floats.
+  INT8     // Changed blocks are sent as 8 bit integers with one float scale per block.
+};
+
+all_reduce_compression all_reduce_compression_from_string(VW::string_view str);
+
+constexpr size_t COMPRESSED_ALL_REDUCE_BLOCK_SIZE = 256;
+
+// Values of one compressed all_reduce call site that are kept between syncs.
+class compressed_all_reduce_buffer
+{
+public:
+  // The value every node is expected to contribute. Only differences from it are sent, so it must be the same on all
+  // nodes, which is the case when it is derived from the result of the previous sync.
+  std::vector<float> expected;
+  // Compression error of this node. It is added to the next difference that is sent so that it is not lost.
+  std::vector<float> residual;
+};
+
+class all_reduce_compression_state
+{
+public:
+  explicit all_reduce_compression_state(all_reduce_compression compression) : compression(compression) {}
+
+  all_reduce_compression compression;
+  compressed_all_reduce_buffer weights;
+  compressed_all_reduce_buffer adaptive_weights;
+};
+
+// Sums n values over all nodes like all_reduce<float, add_float>. Blocks of COMPRESSED_ALL_REDUCE_BLOCK_SIZE values in
+// which every node contributes exactly buffer.expected are not sent at all, the others are sent as differences from it
+// encoded according to the workspace's all_reduce_compression. The caller is responsible for updating buffer.expected.
+void compressed_all_reduce_sum(VW::workspace& all, compressed_all_reduce_buffer& buffer, float* values, size_t n);
+
 void accumulate(VW::workspace& all, parameters& weights, size_t o);
 float accumulate_scalar(VW::workspace& all, float local_sum);
 void accumulate_weighted_avg(VW::workspace& all, parameters& weights);
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include "vw/common/future_compat.h"
+#include "vw/common/string_view.h"
 #include "vw/core/constant.h"
 
 #include <cassert>
 #include <cstdint>
 #include <iterator>
 #include <memory>
+#include <string>
 
 namespace VW
 {
@@ -87,6 +90,37 @@ private:
 };
 }  // namespace details
 
+enum class huge_pages
+{
+  NONE,
+  TRANSPARENT_2MB,  // Ask the kernel to back the weights with transparent huge pages where it can.
+  EXPLICIT_2MB,     // Reserved hugetlbfs pages, see /proc/sys/vm/nr_hugepages.
+  EXPLICIT_1GB
+};
+
+enum class numa_policy
+{
+  DEFAULT,     // Pages are placed by the policy of the process.
+  INTERLEAVE,  // Pages are spread round robin over all online nodes.
+  LOCAL        // Pages are placed on the node of the thread that first touches them.
+};
+
+huge_pages huge_pages_from_string(VW::string_view str);
+numa_policy numa_policy_from_string(VW::string_view str);
+
+// How the storage of dense_parameters is obtained. Anything but the default maps anonymous memory directly, which is
+// only supported on Linux.
+class dense_allocation_options
+{
+public:
+  huge_pages pages = huge_pages::NONE;
+  numa_policy numa = numa_policy::DEFAULT;
+  // Touch every page when allocating so that page faults, and the NUMA placement, happen at startup.
+  bool prefault = false;
+
+  bool is_default() const { return pages == huge_pages::NONE && numa == numa_policy::DEFAULT && !prefault; }
+};
+
 class dense_parameters
 {
 public:
@@ -94,6 +128,7 @@ public:
   using const_iterator = details::dense_iterator<const VW::weight>;
 
   dense_parameters(size_t length, uint32_t stride_shift = 0);
+  dense_parameters(size_t length, uint32_t stride_shift, const dense_allocation_options& allocation);
   dense_parameters();
 
   dense_parameters(const dense_parameters& other) = delete;
@@ -121,9 +156,16 @@ public:
 
   inline const VW::weight& operator[](size_t i) const { return _begin.get()[i & _weight_mask]; }
   inline VW::weight& operator[](size_t i) { return _begin.get()[i & _weight_mask]; }
+  // Starts loading the weight at index i into the cache ahead of its use.
+  inline void prefetch(size_t i) const { VW_PREFETCH(_begin.get() + (i & _weight_mask)); }
 
   VW_ATTR(nodiscard) static dense_parameters shallow_copy(const dense_parameters& input);
   VW_ATTR(nodiscard) static dense_parameters deep_copy(const dense_parameters& input);
+  // Maps length << stride_shift weights stored at the page aligned offset of file_name. Unmodified pages are shared
+  // with every other process mapping the same file. If read_only is false the mapping is copy-on-write, otherwise
+  // writing to the weights is an error. Platforms without mmap read the weights into memory instead.
+  VW_ATTR(nodiscard) static dense_parameters map_file(
+      const std::string& file_name, uint64_t offset, size_t length, uint32_t stride_shift, bool read_only);
 
   inline VW::weight& strided_index(size_t index) { return operator[](index << _stride_shift); }
   inline const VW::weight& strided_index(size_t index) const { return operator[](index << _stride_shift); }
@@ -154,6 +196,9 @@ public:
 
   void stride_shift(uint32_t stride_shift) { _stride_shift = stride_shift; }
 
+  // Used for this array and inherited by deep copies and share().
+  const dense_allocation_options& allocation() const { return _allocation; }
+
 #ifndef _WIN32
 #  ifndef DISABLE_SHARED_WEIGHTS
   void share(size_t length);
@@ -164,6 +209,7 @@ private:
   std::shared_ptr<VW::weight> _begin;
   uint64_t _weight_mask;  // (stride*(1 << num_bits) -1)
   uint32_t _stride_shift;
+  dense_allocation_options _allocation;
 };
 }  // namespace VW
 using dense_parameters VW_DEPRECATED("dense_parameters moved into VW namespace") = VW::dense_parameters;
@@ -0,0 +1,75 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/queue.h"
+#include "vw/io/io_adapter.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+/**
+ * Writes to another writer from a background thread, so that the thread producing output such as predictions never
+ * blocks on a slow file or socket. Writes are collected into buffers of about buffer_size bytes, which are handed to
+ * the background thread through a bounded lock-free queue and written with a single call each. A producer which gets
+ * max_pending_buffers buffers ahead of the background thread waits for it.
+ *
+ * If flush_interval is not zero, a write which happens at least flush_interval after the previous hand off hands off
+ * the current buffer even if it is not full, so that output keeps up with slow input. An error of the inner writer is
+ * rethrown from the next call to write or flush.
+ */
+class async_writer : public VW::io::writer
+{
+public:
+  async_writer(std::unique_ptr<VW::io::writer> inner, size_t buffer_size, size_t max_pending_buffers,
+      std::chrono::milliseconds flush_interval);
+  ~async_writer() override;
+
+  ssize_t write(const char* buffer, size_t num_bytes) override;
+  /// Waits until everything written so far has been written to and flushed by the inner writer.
+  void flush() override;
+
+private:
+  class pending_buffer
+  {
+  public:
+    std::vector<char> data;
+    // Flush the inner writer after writing data, and signal flush_done.
+    bool flush = false;
+  };
+
+  void hand_off(bool flush);
+  void write_buffers();
+  void rethrow_error();
+
+  std::unique_ptr<VW::io::writer> _inner;
+  size_t _buffer_size;
+  std::chrono::milliseconds _flush_interval;
+  std::chrono::steady_clock::time_point _last_hand_off;
+  std::unique_ptr<pending_buffer> _current;
+  VW::ring_queue<std::unique_ptr<pending_buffer>> _pending;
+
+  std::mutex _mutex;
+  std::condition_variable _flush_done;
+  uint64_t _flushes_requested = 0;
+  uint64_t _flushes_done = 0;
+  std::atomic<bool> _failed{false};
+  std::exception_ptr _error;
+
+  std::thread _writer_thread;
+};
+}  // namespace details
+}  // namespace VW
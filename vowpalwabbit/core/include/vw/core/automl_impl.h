@@ -6,6 +6,7 @@
 #include "vw/common/random.h"
 #include "vw/core/array_parameters_dense.h"
 #include "vw/core/learner.h"
+#include "vw/core/learner_replicas.h"
 
 #include <fstream>
 #include <functional>
@@ -277,6 +278,10 @@ public:
   bool debug_reverse_learning_order = false;
   const bool should_save_predict_only_model;
   std::unique_ptr<std::ofstream> log_file;
+  VW::workspace* all = nullptr;
+  // Number of replicas of the base learner which learn challengers alongside this thread, 0 learns every config here.
+  uint64_t learn_threads = 0;
+  std::unique_ptr<VW::details::learner_replicas> replicas;
 
   automl(std::unique_ptr<CMType> cm, VW::io::logger* logger, bool predict_only_model, std::string trace_prefix)
       : cm(std::move(cm)), logger(logger), should_save_predict_only_model(predict_only_model)
@@ -292,6 +297,9 @@ public:
   // This fn gets called before learning any example
   void one_step(VW::LEARNER::learner& base, multi_ex& ec, VW::cb_class& logged, uint64_t labelled_action);
   void offset_learn(VW::LEARNER::learner& base, multi_ex& ec, VW::cb_class& logged, uint64_t labelled_action);
+
+private:
+  void parallel_learn(VW::LEARNER::learner& base, multi_ex& ec, uint64_t labelled_action, float w, float r);
 };
 }  // namespace automl
 
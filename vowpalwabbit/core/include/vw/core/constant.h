@@ -20,6 +20,8 @@ constexpr int CUBIC_CONSTANT2 = 37663;
 constexpr int AFFIX_CONSTANT = 13903957;
 constexpr uint64_t CONSTANT = 11650396;
 constexpr float PROBABILITY_TOLERANCE = 1e-5f;
+// How many features ahead foreach_feature and generate_interactions prefetch weights when asked to.
+constexpr size_t WEIGHT_PREFETCH_DISTANCE = 8;
 
 // FNV-like hash constant for 32bit
 // http://www.isthe.com/chongo/tech/comp/fnv/#FNV-param
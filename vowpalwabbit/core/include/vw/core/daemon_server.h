@@ -0,0 +1,35 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/vw_fwd.h"
+
+namespace VW
+{
+namespace details
+{
+/**
+ * @brief Serves --daemon clients from a single process when --daemon_threads is used, instead of forking children.
+ *
+ * Clients use the same protocols as with the forking daemon. A connection which starts with a zero byte sends examples
+ * which are already hashed, each written by VW::parsers::cache::write_example_to_cache and so prefixed with its size,
+ * and receives a prediction and weight as two floats per example (see VW::details::get_prediction). Predictions which
+ * have no binary form, such as the action scores of a multiline example, are sent to it as text. Other connections
+ * send text and receive text. An epoll loop accepts connections on the socket bound by enable_sources and hands every
+ * connection with pending input to one of the worker threads, which parse all complete lines or binary examples
+ * received so far. The parsed part of an unterminated multiline example is kept until the rest of it arrives. A
+ * connection which sends more than 16MiB without completing an example is closed. Responses the client does not read
+ * yet stay with the connection, and no more of its input is read until they are sent. When training, calls into the
+ * learner are serialized on all. With --testonly every worker predicts through its own workspace sharing the weights of
+ * all, so predictions run concurrently.
+ *
+ * SIGHUP reloads the model from the -i file in the background while the current model keeps serving clients. Once
+ * loaded it replaces the current model for all requests started afterwards, a failed reload is logged and ignored.
+ *
+ * Returns after SIGTERM.
+ */
+void run_threaded_daemon(VW::workspace& all);
+}  // namespace details
+}  // namespace VW
@@ -24,48 +24,68 @@ inline void vec_add(float& p, float fx, float fw) { p += fw * fx; }
 
 }  // namespace details
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_index)
-template <class DataT, void (*FuncT)(DataT&, float feature_value, uint64_t feature_index), class WeightsT>
+// PrefetchDistance is unused, FuncT gets the index and does its own lookups
+template <class DataT, void (*FuncT)(DataT&, float feature_value, uint64_t feature_index), class WeightsT,
+    size_t PrefetchDistance = 0>
 void foreach_feature(WeightsT& /*weights*/, const VW::features& fs, DataT& dat, uint64_t offset = 0, float mult = 1.)
 {
   for (const auto& f : fs) { FuncT(dat, mult * f.value(), f.index() + offset); }
 }
 
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_weight)
-template <class DataT, void (*FuncT)(DataT&, const float feature_value, float& weight_reference), class WeightsT>
+// PrefetchDistance > 0 prefetches the weight of the feature that many positions ahead of the one passed to FuncT
+template <class DataT, void (*FuncT)(DataT&, const float feature_value, float& weight_reference), class WeightsT,
+    size_t PrefetchDistance = 0>
 inline void foreach_feature(WeightsT& weights, const VW::features& fs, DataT& dat, uint64_t offset = 0, float mult = 1.)
 {
-  for (const auto& f : fs)
+  const size_t size = fs.size();
+  for (size_t i = 0; i < size; ++i)
   {
-    VW::weight& w = weights[(f.index() + offset)];
-    FuncT(dat, mult * f.value(), w);
+    if (PrefetchDistance > 0 && i + PrefetchDistance < size)
+    {
+      details::prefetch_weight(weights, fs.indices[i + PrefetchDistance] + offset);
+    }
+    VW::weight& w = weights[(fs.indices[i] + offset)];
+    FuncT(dat, mult * fs.values[i], w);
   }
 }
 
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_weight)
-template <class DataT, void (*FuncT)(DataT&, float, float), class WeightsT>
+template <class DataT, void (*FuncT)(DataT&, float, float), class WeightsT, size_t PrefetchDistance = 0>
 inline void foreach_feature(
     const WeightsT& weights, const VW::features& fs, DataT& dat, uint64_t offset = 0, float mult = 1.)
 {
-  for (const auto& f : fs) { FuncT(dat, mult * f.value(), weights[static_cast<size_t>(f.index() + offset)]); }
+  const size_t size = fs.size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (PrefetchDistance > 0 && i + PrefetchDistance < size)
+    {
+      details::prefetch_weight(weights, fs.indices[i + PrefetchDistance] + offset);
+    }
+    FuncT(dat, mult * fs.values[i], weights[static_cast<size_t>(fs.indices[i] + offset)]);
+  }
 }
 
 template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT),
-    class WeightsT>  // nullptr func can't be used as template param in old
+    class WeightsT,  // nullptr func can't be used as template param in old
                      // compilers
-
+    size_t PrefetchDistance = 0>
 inline void generate_interactions(const std::vector<std::vector<VW::namespace_index>>& interactions,
     const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
     DataT& dat, WeightsT& weights, size_t& num_interacted_features,
     VW::details::generate_interactions_object_cache& cache)  // default value removed to eliminate
                                                              // ambiguity in old complers
 {
-  VW::generate_interactions<DataT, WeightOrIndexT, FuncT, false, details::dummy_func<DataT>, WeightsT>(
+  VW::generate_interactions<DataT, WeightOrIndexT, FuncT, false, details::dummy_func<DataT>, WeightsT,
+      PrefetchDistance>(
       interactions, extent_interactions, permutations, ec, dat, weights, num_interacted_features, cache);
 }
 
 // iterate through all namespaces and quadratic&cubic features, callback function FuncT(some_data_R, feature_value_x,
 // WeightOrIndexT) where WeightOrIndexT is EITHER float& feature_weight OR uint64_t feature_index
-template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class WeightsT>
+// PrefetchDistance > 0 prefetches weights that many features ahead of FuncT, linear and interacted alike
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class WeightsT,
+    size_t PrefetchDistance = 0>
 inline void foreach_feature(WeightsT& weights, bool ignore_some_linear,
     std::array<bool, VW::NUM_NAMESPACES>& ignore_linear,
     const std::vector<std::vector<VW::namespace_index>>& interactions,
@@ -80,20 +100,21 @@ inline void foreach_feature(WeightsT& weights, bool ignore_some_linear,
       if (!ignore_linear[i.index()])
       {
         VW::features& f = *i;
-        foreach_feature<DataT, FuncT, WeightsT>(weights, f, dat, offset);
+        foreach_feature<DataT, FuncT, WeightsT, PrefetchDistance>(weights, f, dat, offset);
       }
     }
   }
   else
   {
-    for (VW::features& f : ec) { foreach_feature<DataT, FuncT, WeightsT>(weights, f, dat, offset); }
+    for (VW::features& f : ec) { foreach_feature<DataT, FuncT, WeightsT, PrefetchDistance>(weights, f, dat, offset); }
   }
 
-  generate_interactions<DataT, WeightOrIndexT, FuncT, WeightsT>(
+  generate_interactions<DataT, WeightOrIndexT, FuncT, WeightsT, PrefetchDistance>(
       interactions, extent_interactions, permutations, ec, dat, weights, num_interacted_features, cache);
 }
 
-template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class WeightsT>
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), class WeightsT,
+    size_t PrefetchDistance = 0>
 inline void foreach_feature(WeightsT& weights, bool ignore_some_linear,
     std::array<bool, VW::NUM_NAMESPACES>& ignore_linear,
     const std::vector<std::vector<VW::namespace_index>>& interactions,
@@ -101,31 +122,31 @@ inline void foreach_feature(WeightsT& weights, bool ignore_some_linear,
     DataT& dat, VW::details::generate_interactions_object_cache& cache)
 {
   size_t num_interacted_features_ignored = 0;
-  foreach_feature<DataT, WeightOrIndexT, FuncT, WeightsT>(weights, ignore_some_linear, ignore_linear, interactions,
-      extent_interactions, permutations, ec, dat, num_interacted_features_ignored, cache);
+  foreach_feature<DataT, WeightOrIndexT, FuncT, WeightsT, PrefetchDistance>(weights, ignore_some_linear, ignore_linear,
+      interactions, extent_interactions, permutations, ec, dat, num_interacted_features_ignored, cache);
 }
 
-template <class WeightsT>
+template <class WeightsT, size_t PrefetchDistance = 0>
 inline float inline_predict(WeightsT& weights, bool ignore_some_linear,
     std::array<bool, VW::NUM_NAMESPACES>& ignore_linear,
     const std::vector<std::vector<VW::namespace_index>>& interactions,
     const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
     VW::details::generate_interactions_object_cache& cache, float initial = 0.f)
 {
-  foreach_feature<float, float, details::vec_add, WeightsT>(
+  foreach_feature<float, float, details::vec_add, WeightsT, PrefetchDistance>(
       weights, ignore_some_linear, ignore_linear, interactions, extent_interactions, permutations, ec, initial, cache);
   return initial;
 }
 
-template <class WeightsT>
+template <class WeightsT, size_t PrefetchDistance = 0>
 inline float inline_predict(WeightsT& weights, bool ignore_some_linear,
     std::array<bool, VW::NUM_NAMESPACES>& ignore_linear,
     const std::vector<std::vector<VW::namespace_index>>& interactions,
     const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
     size_t& num_interacted_features, VW::details::generate_interactions_object_cache& cache, float initial = 0.f)
 {
-  foreach_feature<float, float, details::vec_add, WeightsT>(weights, ignore_some_linear, ignore_linear, interactions,
-      extent_interactions, permutations, ec, initial, num_interacted_features, cache);
+  foreach_feature<float, float, details::vec_add, WeightsT, PrefetchDistance>(weights, ignore_some_linear,
+      ignore_linear, interactions, extent_interactions, permutations, ec, initial, num_interacted_features, cache);
   return initial;
 }
 }  // namespace VW
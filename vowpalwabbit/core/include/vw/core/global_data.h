@@ -46,6 +46,7 @@ namespace VW
 {
 namespace details
 {
+class all_reduce_compression_state;
 using feature_dict = std::unordered_map<std::string, std::unique_ptr<VW::features>>;
 class dictionary_info
 {
@@ -153,6 +154,7 @@ public:
   bool save_per_pass;
   std::string per_feature_regularizer_output;
   std::string per_feature_regularizer_text;
+  bool mmap_model = false;  // write binary model files in the page aligned, memory-mappable format
 };
 
 class passes_config
@@ -179,6 +181,15 @@ public:
   bool normal_weights;
   bool tnormal_weights;
   std::string per_feature_regularizer_input;
+  // Set when the initial regressor is in the memory-mappable format. Its weights are mapped from this file instead of
+  // being read from the model stream.
+  std::string mapped_weights_file;
+  uint64_t mapped_weights_offset = 0;
+  uint64_t mapped_weights_size = 0;  // in bytes
+  uint32_t mapped_weights_stride_shift = 0;
+  bool mapped_weights_read_only = false;
+  // How dense weights are allocated, set by --weights_huge_pages, --weights_numa and --weights_prefault.
+  VW::dense_allocation_options dense_allocation;
 };
 
 class update_rule_config
@@ -239,8 +250,13 @@ public:
   // bool nonormalize; not used?
   bool do_reset_source;
   std::unique_ptr<all_reduce_base> all_reduce;
+  // Set when --all_reduce_compression is used, holds the values kept between compressed syncs.
+  std::unique_ptr<details::all_reduce_compression_state> all_reduce_compression;
   VW::details::generate_interactions_object_cache generate_interactions_object_cache_state;
   uint64_t parse_mask;  // 1 << num_bits -1
+  // When true gd neither reads nor writes weights through the model stream, they are stored after it in the
+  // memory-mappable model format.
+  bool model_weights_external = false;
 };
 
 class parser_runtime
@@ -301,6 +317,9 @@ public:
   void learn(multi_ex&);
   void predict(example&);
   void predict(multi_ex&);
+  /// Predicts a batch of independent single line examples, as if predict(example&) was called for each of them.
+  /// Learners which support it score the whole batch in one pass down the reduction stack.
+  void predict_batch(multi_ex&);
   void finish_example(example&);
   void finish_example(multi_ex&);
 
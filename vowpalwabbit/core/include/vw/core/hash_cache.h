@@ -0,0 +1,65 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/hashstring.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace VW
+{
+class hash_cache_stats
+{
+public:
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+
+namespace details
+{
+/**
+ * Remembers the hashes which one of the functions returned by VW::get_hasher computed for recently seen strings, so
+ * that they are not hashed again. Every thread which hashes through the cache gets its own bounded, direct-mapped
+ * table, so no locking is needed once a thread has its table. The tables are kept until the cache is destroyed. Long
+ * strings are not cached.
+ *
+ * A workspace owns its cache, which is set up by --hash_cache_size.
+ */
+class hash_cache
+{
+public:
+  /// num_entries is the size of the table of each thread, which is rounded up to a power of two.
+  hash_cache(hash_func_t hasher, size_t num_entries);
+  ~hash_cache();
+
+  hash_cache(const hash_cache&) = delete;
+  hash_cache& operator=(const hash_cache&) = delete;
+
+  uint32_t hash(const char* s, size_t len, uint32_t seed);
+
+  hash_func_t get_hasher() const { return _hasher; }
+  size_t size() const { return _num_entries; }
+
+  /// Returns the number of hits and misses of all threads since the cache was created.
+  hash_cache_stats get_stats() const;
+
+private:
+  class table;
+  table& get_table();
+
+  hash_func_t _hasher;
+  size_t _num_entries;
+  // Tells this cache apart from destroyed caches which had the same address.
+  uint64_t _id;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::thread::id, std::unique_ptr<table>> _tables;
+};
+}  // namespace details
+}  // namespace VW
@@ -47,6 +47,37 @@ using hash_func_t = uint32_t (*)(const char*, size_t, uint32_t);
 
 hash_func_t get_hasher(const std::string& s);
 
+namespace details
+{
+class hash_cache;
+}
+
+/// The hash function of a parser. It calls one of the functions returned by get_hasher, either directly or through a
+/// details::hash_cache which remembers the hashes of recently seen names.
+class feature_hasher
+{
+public:
+  feature_hasher() = default;
+  // Not explicit, so that a hash_func_t can be passed wherever a feature_hasher is expected.
+  feature_hasher(hash_func_t hasher) : _hasher(hasher) {}  // NOLINT
+  explicit feature_hasher(details::hash_cache& cache);
+
+  uint32_t operator()(const char* s, size_t len, uint32_t seed) const
+  {
+    return _cache == nullptr ? _hasher(s, len, seed) : cached_hash(s, len, seed);
+  }
+
+  /// Returns the function which computes the hashes, whether or not they are cached.
+  hash_func_t get_hash_function() const { return _hasher; }
+  details::hash_cache* get_cache() const { return _cache; }
+
+private:
+  uint32_t cached_hash(const char* s, size_t len, uint32_t seed) const;
+
+  hash_func_t _hasher = nullptr;
+  details::hash_cache* _cache = nullptr;
+};
+
 }  // namespace VW
 using hash_func_t VW_DEPRECATED("Moved into VW namespace") = VW::hash_func_t;
 
@@ -52,6 +52,24 @@ inline void call_func_t(DataT& dat, WeightsT& /*weights*/, const float ft_value,
   FuncT(dat, ft_value, ft_idx);
 }
 
+// Starts loading the weight at ft_idx when WeightsT supports it, dense_parameters does. A no-op otherwise.
+template <class WeightsT>
+inline auto prefetch_weight(const WeightsT& weights, uint64_t ft_idx, int) -> decltype(weights.prefetch(ft_idx))
+{
+  weights.prefetch(ft_idx);
+}
+
+template <class WeightsT>
+inline void prefetch_weight(const WeightsT& /*weights*/, uint64_t /*ft_idx*/, long)
+{
+}
+
+template <class WeightsT>
+inline void prefetch_weight(const WeightsT& weights, uint64_t ft_idx)
+{
+  prefetch_weight(weights, ft_idx, 0);
+}
+
 inline bool term_is_empty(VW::namespace_index term, const std::array<VW::features, VW::NUM_NAMESPACES>& feature_groups)
 {
   return feature_groups[term].empty();
@@ -201,12 +219,32 @@ std::vector<VW::details::features_range_t> inline generate_generic_char_combinat
   return inter;
 }
 
+// PrefetchDistance > 0 prefetches the weight of the interacted feature that many positions ahead of the one passed to
+// FuncT, which hides most of the cache misses of large weight tables.
 template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), bool audit,
-    void (*audit_func)(DataT&, const VW::audit_strings*), class WeightsT>
+    void (*audit_func)(DataT&, const VW::audit_strings*), class WeightsT, size_t PrefetchDistance = 0>
 void inner_kernel(DataT& dat, VW::features::const_audit_iterator& begin, VW::features::const_audit_iterator& end,
     const uint64_t offset, WeightsT& weights, VW::feature_value ft_value, VW::feature_index halfhash)
 {
-  if (audit)
+  if (PrefetchDistance > 0 && !audit)
+  {
+    auto ahead = begin;
+    for (size_t i = 0; i < PrefetchDistance && ahead != end; ++i, ++ahead)
+    {
+      prefetch_weight(weights, (ahead.index() ^ halfhash) + offset);
+    }
+    for (; begin != end; ++begin)
+    {
+      if (ahead != end)
+      {
+        prefetch_weight(weights, (ahead.index() ^ halfhash) + offset);
+        ++ahead;
+      }
+      call_func_t<DataT, FuncT>(
+          dat, weights, interaction_value(ft_value, begin.value()), (begin.index() ^ halfhash) + offset);
+    }
+  }
+  else if (audit)
   {
     for (; begin != end; ++begin)
     {
@@ -406,9 +444,11 @@ size_t process_generic_interaction(const std::vector<VW::details::features_range
 // this templated function generates new features for given example and set of interactions
 // and passes each of them to given function FuncT()
 // it must be in header file to avoid compilation problems
+// PrefetchDistance > 0 prefetches weights ahead of FuncT, see details::inner_kernel
 template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), bool audit,
     void (*audit_func)(DataT&, const VW::audit_strings*),
-    class WeightsT>  // nullptr func can't be used as template param in old compilers
+    class WeightsT,  // nullptr func can't be used as template param in old compilers
+    size_t PrefetchDistance = 0>
 inline void generate_interactions(const std::vector<std::vector<VW::namespace_index>>& interactions,
     const std::vector<std::vector<VW::extent_term>>& extent_interactions, bool permutations, VW::example_predict& ec,
     DataT& dat, WeightsT& weights, size_t& num_features,
@@ -420,7 +460,7 @@ inline void generate_interactions(const std::vector<std::vector<VW::namespace_in
   const auto inner_kernel_func = [&](VW::features::const_audit_iterator begin, VW::features::const_audit_iterator end,
                                      VW::feature_value value, VW::feature_index index)
   {
-    details::inner_kernel<DataT, WeightOrIndexT, FuncT, audit, audit_func>(
+    details::inner_kernel<DataT, WeightOrIndexT, FuncT, audit, audit_func, WeightsT, PrefetchDistance>(
         dat, begin, end, ec.ft_offset, weights, value, index);
   };
 
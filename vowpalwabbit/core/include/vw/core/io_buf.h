@@ -40,6 +40,11 @@
 ** The interval [head, _buffer.end] may be shifted down to _buffer.begin
 ** if the requested number of bytes to be read is larger than the interval size.
 ** This is done to avoid reallocating arrays as much as possible.
+**
+** When the buffer is empty and the current input file supports
+** VW::io::reader::read_view, reads return pointers into the view of the file
+** instead and the buffer is bypassed. Only the end of the view, which may
+** have to be joined with the next file, is copied into the buffer.
 */
 namespace VW
 {
@@ -104,7 +109,12 @@ public:
    */
   bool is_resettable() const;
 
-  void set(char* p) { _head = p; }
+  // Moves the read position to p, which must have been returned by the last read from this buffer.
+  void set(char* p)
+  {
+    if (_view_head != nullptr) { _view_head = p; }
+    else { _head = p; }
+  }
 
   /// This function will return the number of input files AS WELL AS the number of output files. (because of legacy)
   size_t num_files() const { return _input_files.size() + _output_files.size(); }
@@ -150,6 +160,7 @@ public:
   {
     if (!_input_files.empty())
     {
+      if (_current == _input_files.size() - 1) { end_view(); }
       _input_files.pop_back();
       return true;
     }
@@ -245,6 +256,11 @@ public:
   char* buffer_start() { return _buffer.begin; }  // This should be replaced with slicing.
 
 private:
+  // Starts reading the current input file through its view, only when the buffer is empty.
+  bool start_view();
+  // Moves the unread part of the view into the buffer.
+  void end_view();
+
   // io_buf requires a grow only variant of v_array where it has access to the internals.
   // It sets the begin, end and endarray members often and does not need the complexity
   // of a generic container type, hence why a thin object is defined here.
@@ -297,6 +313,10 @@ private:
   internal_buffer _buffer;
   char* _head = nullptr;
 
+  // Unread part of the view of the current input file, both are null when no view is being read.
+  char* _view_head = nullptr;
+  char* _view_end = nullptr;
+
   // file descriptor currently being used.
   size_t _current = 0;
 
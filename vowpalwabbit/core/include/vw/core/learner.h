@@ -67,6 +67,7 @@ using void_func = std::function<void(void)>;
 using example_func = std::function<void(polymorphic_ex ex)>;
 using multipredict_func =
     std::function<void(polymorphic_ex ex, size_t count, size_t step, polyprediction* pred, bool finalize_predictions)>;
+using predict_batch_func = std::function<void(multi_ex& examples)>;
 
 using sensitivity_func = std::function<float(example& ex)>;
 using save_load_func = std::function<void(io_buf&, bool read, bool text)>;
@@ -177,6 +178,15 @@ public:
 
   void multipredict(polymorphic_ex ec, size_t lo, size_t count, polyprediction* pred, bool finalize_predictions);
 
+  /// \brief Make predictions for a batch of independent single line examples.
+  /// \param examples The examples to be operated on. Each of them is handled as
+  /// if it was passed to predict() on its own, not as a ::multi_ex of a multiline learner.
+  /// \param i This is the offset used for the feature_width in this call, as for predict().
+  /// \returns The prediction calculated for every example is set on its
+  /// example::pred. Learners which don't define a batched predict call predict()
+  /// for each example instead.
+  void predict_batch(multi_ex& examples, size_t i = 0);
+
   void update(polymorphic_ex ec, size_t i = 0);
 
   float sensitivity(example& ec, size_t i = 0);
@@ -234,6 +244,7 @@ public:
   VW_ATTR(nodiscard) bool has_print_update() const { return _print_update_f != nullptr; }
   VW_ATTR(nodiscard) bool has_output_example_prediction() const { return _output_example_prediction_f != nullptr; }
   VW_ATTR(nodiscard) bool has_cleanup_example() const { return _cleanup_example_f != nullptr; }
+  VW_ATTR(nodiscard) bool has_predict_batch() const { return _predict_batch_f != nullptr; }
   VW_ATTR(nodiscard) bool has_merge() const { return (_merge_with_all_f != nullptr) || (_merge_f != nullptr); }
   VW_ATTR(nodiscard) bool has_add() const { return (_add_with_all_f != nullptr) || (_add_f != nullptr); }
   VW_ATTR(nodiscard) bool has_subtract() const { return (_subtract_with_all_f != nullptr) || (_subtract_f != nullptr); }
@@ -278,6 +289,7 @@ private:
   details::example_func _predict_f;
   details::example_func _update_f;
   details::multipredict_func _multipredict_f;
+  details::predict_batch_func _predict_batch_f;
   details::sensitivity_func _sensitivity_f;
 
   details::finish_example_func _finish_example_f;
@@ -585,6 +597,13 @@ public:
     { fn_ptr(*data, *base, ex, count, step, pred, finalize_predictions); };
   )
 
+  LEARNER_BUILDER_DEFINE(set_predict_batch(void (*fn_ptr)(DataT&, learner&, multi_ex&)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    learner* base = this->learner_ptr->get_base_learner();
+    this->learner_ptr->_predict_batch_f = [fn_ptr, data, base](multi_ex& examples) { fn_ptr(*data, *base, examples); };
+  )
+
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(DataT& data, learner&, ExampleT&)),
     assert(fn_ptr != nullptr);
     DataT* data = this->learner_data.get();
@@ -754,7 +773,11 @@ public:
     { fn_ptr(*data, ex, count, step, pred, finalize_predictions); };
   )
 
-
+  LEARNER_BUILDER_DEFINE(set_predict_batch(void (*fn_ptr)(DataT&, multi_ex&)),
+    assert(fn_ptr != nullptr);
+    DataT* data = this->learner_data.get();
+    this->learner_ptr->_predict_batch_f = [fn_ptr, data](multi_ex& examples) { fn_ptr(*data, examples); };
+  )
 
   LEARNER_BUILDER_DEFINE(set_update(void (*fn_ptr)(DataT& data, ExampleT&)),
     assert(fn_ptr != nullptr);
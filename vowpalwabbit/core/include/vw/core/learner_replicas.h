@@ -0,0 +1,71 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/multi_ex.h"
+#include "vw/core/thread_pool.h"
+#include "vw/core/vw_fwd.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VW
+{
+namespace details
+{
+/**
+ * Copies of the learners below one reduction of a workspace's stack, which let that reduction call its base for
+ * several models at once. Every replica lives in a workspace of its own, built from the learning options of the
+ * original, which shares the weights of the original but has its own shared data, scratch state and examples. Calls
+ * for models at disjoint offsets then touch disjoint weights and no common state.
+ *
+ * State which the base learners keep for each model, such as the normalization totals of gd, is kept by whichever
+ * learner handles that model, so model i is always handled by worker i % (size() + 1). Worker 0 is the calling thread
+ * with the original base learner and examples, worker w is replica w - 1 on a thread of its own. Every call starts
+ * from the shared data of the original as it was before the call, and from its current weights, even if they were
+ * replaced since the replicas were built.
+ */
+class learner_replicas
+{
+public:
+  using multi_model_func = std::function<void(size_t, VW::LEARNER::learner&, VW::multi_ex&)>;
+  using single_model_func = std::function<void(size_t, VW::LEARNER::learner&, VW::example&)>;
+
+  /// reduction_name is the name of the reduction whose base is replicated. Options named in excluded_options, such as
+  /// the one which enabled the replicas, are not passed on to the replicas.
+  learner_replicas(VW::workspace& all, const std::string& reduction_name, size_t num_replicas,
+      const std::vector<std::string>& excluded_options);
+  ~learner_replicas();
+
+  learner_replicas(const learner_replicas&) = delete;
+  learner_replicas& operator=(const learner_replicas&) = delete;
+
+  /// Throws if all uses options with which learning on several threads is not safe, such as regularization which
+  /// updates every weight.
+  static void check_supported(const VW::workspace& all);
+
+  size_t size() const { return _replicas.size(); }
+
+  /// Calls fn(i, base, examples) for models 0 to num_models - 1, where a replica gets its own copy of the examples.
+  /// Every worker handles its models in decreasing order, so model 0 is the last one to use the original examples.
+  /// Waits for all workers and rethrows the first exception.
+  void for_each_model(
+      size_t num_models, VW::LEARNER::learner& base, VW::multi_ex& examples, const multi_model_func& fn);
+  void for_each_model(size_t num_models, VW::LEARNER::learner& base, VW::example& ec, const single_model_func& fn);
+
+private:
+  class replica;
+
+  // Points the replicas at the weights of the original again if those were replaced since the last call.
+  void share_weights();
+
+  VW::workspace& _all;
+  std::vector<std::unique_ptr<replica>> _replicas;
+  VW::thread_pool _pool;
+};
+}  // namespace details
+}  // namespace VW
@@ -25,6 +25,8 @@ public:
   std::string pid_file;
   std::string port_file;
   uint64_t num_children;
+  // Serve clients from this many threads of one process instead of forking num_children processes.
+  uint64_t daemon_threads = 0;
   // If a model was saved in daemon or active learning mode, force it to accept
   // local input when loaded instead.
   bool no_daemon = false;
@@ -32,10 +34,15 @@ public:
 
   bool cache;
   std::vector<std::string> cache_files;
+  std::string cache_format;
+  bool shuffle_blocks = false;
+  uint64_t shuffle_window = 0;
+  bool mmap_input = false;
   bool json;
   bool dsjson;
   bool kill_cache;
   bool compressed;
+  uint64_t decompress_threads = 0;
   bool chain_hash_json;
   bool flatbuffer = false;
 #ifdef VW_FEAT_CSV_ENABLED
@@ -86,5 +86,10 @@ void parse_dispatch(VW::workspace& all, DispatchFuncT& dispatch)
   VW::details::lock_done(*all.parser_runtime.example_parser);
 }
 
+// Same contract as parse_dispatch, but lines of text input are parsed by a pool of parser.parse_threads workers. Examples
+// are still set up and dispatched in input order. Inputs which are not plain text fall back to parse_dispatch.
+void parallel_parse_dispatch(
+    VW::workspace& all, const std::function<void(VW::workspace&, const VW::multi_ex&)>& dispatch);
+
 }  // namespace details
 }  // namespace VW
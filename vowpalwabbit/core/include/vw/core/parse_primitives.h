@@ -7,13 +7,13 @@
 
 #include "vw/common/future_compat.h"
 #include "vw/common/string_view.h"
-#include "vw/core/fast_pow10.h"
 #include "vw/core/hashstring.h"
 #include "vw/core/v_array.h"
 #include "vw/io/logger.h"
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 namespace VW
@@ -29,8 +29,20 @@ std::vector<std::string> escaped_tokenize(char delim, VW::string_view s, bool al
 //  - much faster (around 50% but depends on the  string to parse)
 //  - less error control, but utilised inside a very strict parser
 //    in charge of error detection.
+//
+// The result is correctly rounded. Numbers with at most 15 significant digits
+// and a decimal exponent of at most 22 in magnitude, which covers nearly all
+// feature values, are converted with a single exactly rounded double operation
+// (Clinger's fast path). Anything else is left to strtof.
 inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char* end_line = nullptr)
 {
+  // Powers of ten which are exactly representable as doubles.
+  static constexpr double EXACT_POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+      1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr int MAX_EXACT_POW10 = 22;
+  // Integers of up to 15 digits are below 2^53, so they are exactly representable as doubles.
+  constexpr int MAX_MANTISSA_DIGITS = 15;
+
   const char* start = p;
   bool end_line_is_null = end_line == nullptr;
 
@@ -46,19 +58,25 @@ inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char
     p++;
   }
 
-  float acc = 0;
-  while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line)) { acc = acc * 10 + *p++ - '0'; }
+  uint64_t mantissa = 0;
+  int num_digits = 0;
+  int exp10 = 0;
+  while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line))
+  {
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*p++ - '0');
+    // Leading zeros are not significant.
+    if (mantissa != 0) { num_digits++; }
+    if (num_digits > MAX_MANTISSA_DIGITS) { break; }
+  }
 
-  int num_dec = 0;
-  if (*p == '.')
+  if (*p == '.' && num_digits <= MAX_MANTISSA_DIGITS)
   {
     while (*(++p) >= '0' && *p <= '9' && (end_line_is_null || p < end_line))
     {
-      if (num_dec < 35)
-      {
-        acc = acc * 10 + (*p - '0');
-        num_dec++;
-      }
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+      exp10--;
+      if (mantissa != 0) { num_digits++; }
+      if (num_digits > MAX_MANTISSA_DIGITS) { break; }
     }
   }
 
@@ -72,23 +90,37 @@ inline FORCE_INLINE float parse_float(const char* p, size_t& end_idx, const char
       exp_s = -1;
       p++;
     }
-    while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line)) { exp_acc = exp_acc * 10 + *p++ - '0'; }
-    exp_acc *= exp_s;
-  }
-  if (*p == ' ' || *p == '\n' || *p == '\t' || p == end_line)  // easy case succeeded.
-  {
-    acc *= VW::fast_pow10(static_cast<int8_t>(exp_acc - num_dec));
-    end_idx = p - start;
-    return s * acc;
+    while (*p >= '0' && *p <= '9' && (end_line_is_null || p < end_line))
+    {
+      // Exponents this large are left to strtof, this only keeps exp_acc from overflowing.
+      if (exp_acc < 1000) { exp_acc = exp_acc * 10 + *p - '0'; }
+      p++;
+    }
+    exp10 += exp_acc * exp_s;
   }
-  else
+  if ((*p == ' ' || *p == '\n' || *p == '\t' || p == end_line) && num_digits <= MAX_MANTISSA_DIGITS &&
+      exp10 >= -MAX_EXACT_POW10 && exp10 <= MAX_EXACT_POW10)  // easy case succeeded.
   {
-    // can't use stod because that throws an exception. Use strtod instead.
-    char* end = nullptr;
-    auto ret = strtof(start, &end);
-    if (end >= start) { end_idx = end - start; }
-    return ret;
+    // Both operands are exact, so the double result is correctly rounded.
+    const double value = exp10 < 0 ? static_cast<double>(mantissa) / EXACT_POW10[-exp10]
+                                   : static_cast<double>(mantissa) * EXACT_POW10[exp10];
+    // Rounding the double to float is only ambiguous if it lies exactly halfway between two floats. Otherwise it is on
+    // the same side of every float rounding boundary as the exact value.
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr uint64_t FLOAT_ROUNDING_BITS = (uint64_t{1} << 29) - 1;
+    if ((bits & FLOAT_ROUNDING_BITS) != (uint64_t{1} << 28))
+    {
+      end_idx = p - start;
+      return static_cast<float>(s * value);
+    }
   }
+
+  // can't use stod because that throws an exception. Use strtod instead.
+  char* end = nullptr;
+  auto ret = strtof(start, &end);
+  if (end >= start) { end_idx = end - start; }
+  return ret;
 }
 
 inline float float_of_string(VW::string_view s, VW::io::logger& logger)
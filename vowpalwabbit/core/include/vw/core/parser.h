@@ -17,10 +17,12 @@
 #  include <mutex>
 #endif
 
+#include "vw/cache_parser/block_cache.h"
 #include "vw/cache_parser/parse_example_cache.h"
 #include "vw/common/future_compat.h"
 #include "vw/common/string_view.h"
 #include "vw/core/example.h"
+#include "vw/core/hash_cache.h"
 #include "vw/core/hashstring.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/object_pool.h"
@@ -56,7 +58,7 @@ public:
   std::vector<VW::string_view> words;
 
   VW::object_pool<VW::example> example_pool;
-  VW::thread_safe_queue<VW::example*> ready_parsed_examples;
+  VW::ring_queue<VW::example*> ready_parsed_examples;
 
   io_buf input;  // Input source(s)
 
@@ -70,10 +72,20 @@ public:
   /// text_reader consumes the char* input and is for text based parsing
   void (*text_reader)(VW::workspace*, VW::string_view, VW::multi_ex&);
 
-  hash_func_t hasher;
+  VW::feature_hasher hasher;
+  // Set by --hash_cache_size, hasher then hashes through this cache.
+  std::unique_ptr<details::hash_cache> feature_hash_cache;
   bool resettable;  // Whether or not the input can be reset.
   io_buf output;    // Where to output the cache.
   VW::parsers::cache::details::cache_temp_buffer cache_temp_buffer_obj;
+  // Set when the cache is written, or read, in the block format of --cache_format v2.
+  std::unique_ptr<VW::parsers::cache::block_cache_writer> block_cache_writer;
+  std::unique_ptr<VW::parsers::cache::block_cache_reader> block_cache_reader;
+  // Set by --shuffle_blocks, passes over a block cache visit its blocks in a random order.
+  bool shuffle_blocks = false;
+  size_t shuffle_window = 0;
+  // Set by --mmap_input, uncompressed data and cache files are mapped into memory and parsed in place.
+  bool mmap_input = false;
   std::string currentname;
   std::string finalname;
 
@@ -81,6 +93,9 @@ public:
   bool sort_features = false;
 
   size_t example_queue_limit;
+  // Number of threads used to parse text input or decode cache blocks. Values greater than one enable
+  // parallel_parse_dispatch for text input.
+  size_t parse_threads = 1;
   std::atomic<uint64_t> num_examples_taken_from_pool;
   std::atomic<uint64_t> num_setup_examples;
   std::atomic<uint64_t> num_finished_examples;
@@ -94,6 +109,8 @@ public:
   bool done = false;
 
   int bound_sock = 0;
+  // Number of threads serving daemon clients, zero when daemon mode forks children instead.
+  size_t daemon_threads = 0;
 
   VW::label_parser_reuse_mem parser_memory_to_reuse;
 
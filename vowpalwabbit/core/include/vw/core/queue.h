@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <queue>
+#include <thread>
+#include <vector>
 
 // Mutex and CV cannot be used in managed C++, tell the compiler that this is unmanaged even if included in a managed
 // project.
@@ -77,4 +81,213 @@ private:
   std::condition_variable _is_not_full;
   std::condition_variable _is_not_empty;
 };
+
+// Bounded multi-producer multi-consumer ring buffer with the same interface as thread_safe_queue.
+// Push and pop only touch atomics on the fast path. A thread which finds the queue full (or empty) spins, then yields,
+// and only then parks on a condition variable. The other side only takes the mutex to wake it if something is parked.
+// Based on Dmitry Vyukov's bounded MPMC queue.
+template <typename T>
+class ring_queue
+{
+public:
+  // The sequence numbers of a single cell cannot tell a full cell from an empty one, so there are at least two.
+  ring_queue(size_t max_size) : _max_size(max_size < 2 ? 2 : max_size), _cells(_max_size)
+  {
+    for (size_t i = 0; i < _max_size; ++i) { _cells[i].sequence.store(i, std::memory_order_relaxed); }
+  }
+
+  ring_queue(const ring_queue&) = delete;
+  ring_queue& operator=(const ring_queue&) = delete;
+
+  // Blocks until an item is available. Returns false only if the queue is done and empty.
+  bool try_pop(T& item)
+  {
+    size_t attempts = 0;
+    while (true)
+    {
+      if (try_pop_no_wait(item)) { return true; }
+      if (_done.load(std::memory_order_acquire)) { return try_pop_no_wait(item); }
+      if (attempts++ < SPIN_ATTEMPTS) { continue; }
+      if (attempts < SPIN_ATTEMPTS + YIELD_ATTEMPTS)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+
+      bool popped = false;
+      {
+        std::unique_lock<std::mutex> lock(_mut);
+        _waiting_consumers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!(popped = dequeue(item)) && !_done.load(std::memory_order_acquire)) { _is_not_empty.wait(lock); }
+        _waiting_consumers.fetch_sub(1, std::memory_order_relaxed);
+      }
+      if (!popped) { return try_pop_no_wait(item); }
+      wake_producers();
+      return true;
+    }
+  }
+
+  // Blocks while the queue is full.
+  void push(T item)
+  {
+    push_wait(item);
+    wake_consumers();
+  }
+
+  // Pushes all items in [first, last) and wakes parked consumers once instead of once per item.
+  template <typename It>
+  void push_batch(It first, It last)
+  {
+    for (; first != last; ++first)
+    {
+      T item = *first;
+      push_wait(item);
+    }
+    wake_consumers();
+  }
+
+  void set_done()
+  {
+    {
+      std::unique_lock<std::mutex> lock(_mut);
+      _done.store(true, std::memory_order_release);
+    }
+    _is_not_empty.notify_all();
+    _is_not_full.notify_all();
+  }
+
+  // Approximate when called concurrently with push or pop.
+  size_t size() const
+  {
+    const size_t tail = _dequeue_pos.value.load(std::memory_order_acquire);
+    const size_t head = _enqueue_pos.value.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+  }
+
+private:
+  static constexpr size_t SPIN_ATTEMPTS = 64;
+  static constexpr size_t YIELD_ATTEMPTS = 16;
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  struct cell
+  {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  bool try_push_no_wait(T& item)
+  {
+    size_t pos = _enqueue_pos.value.load(std::memory_order_relaxed);
+    while (true)
+    {
+      cell& c = _cells[pos % _max_size];
+      const size_t seq = c.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0)
+      {
+        if (_enqueue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          c.data = std::move(item);
+          c.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) { return false; }
+      else { pos = _enqueue_pos.value.load(std::memory_order_relaxed); }
+    }
+  }
+
+  bool try_pop_no_wait(T& item)
+  {
+    if (!dequeue(item)) { return false; }
+    wake_producers();
+    return true;
+  }
+
+  bool dequeue(T& item)
+  {
+    size_t pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+    while (true)
+    {
+      cell& c = _cells[pos % _max_size];
+      const size_t seq = c.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+      if (diff == 0)
+      {
+        if (_dequeue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          item = std::move(c.data);
+          c.sequence.store(pos + _max_size, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) { return false; }
+      else { pos = _dequeue_pos.value.load(std::memory_order_relaxed); }
+    }
+  }
+
+  // Does not wake consumers, the caller is responsible for calling wake_consumers.
+  void push_wait(T& item)
+  {
+    size_t attempts = 0;
+    while (!try_push_no_wait(item))
+    {
+      if (attempts++ < SPIN_ATTEMPTS) { continue; }
+      if (attempts < SPIN_ATTEMPTS + YIELD_ATTEMPTS)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+
+      // Consumers may be parked waiting for items pushed earlier in a batch.
+      wake_consumers();
+      std::unique_lock<std::mutex> lock(_mut);
+      _waiting_producers.fetch_add(1, std::memory_order_seq_cst);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      while (!try_push_no_wait(item)) { _is_not_full.wait(lock); }
+      _waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  void wake_consumers()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiting_consumers.load(std::memory_order_relaxed) > 0)
+    {
+      { std::unique_lock<std::mutex> lock(_mut); }
+      _is_not_empty.notify_all();
+    }
+  }
+
+  void wake_producers()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiting_producers.load(std::memory_order_relaxed) > 0)
+    {
+      { std::unique_lock<std::mutex> lock(_mut); }
+      _is_not_full.notify_all();
+    }
+  }
+
+  // Padding keeps the producer and consumer positions on separate cache lines.
+  struct padded_counter
+  {
+    std::atomic<size_t> value{0};
+    char padding[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+  };
+
+  const size_t _max_size;
+  std::vector<cell> _cells;
+  padded_counter _enqueue_pos;
+  padded_counter _dequeue_pos;
+  std::atomic<size_t> _waiting_producers{0};
+  std::atomic<size_t> _waiting_consumers{0};
+  std::atomic<bool> _done{false};
+
+  std::mutex _mut;
+  std::condition_variable _is_not_full;
+  std::condition_variable _is_not_empty;
+};
 }  // namespace VW
@@ -27,13 +27,14 @@ public:
   bool update_statistics(const VW::example& ec, const VW::multi_ex& ec_seq, VW::shared_data& sd) const;
 
   cb_adf(VW::cb_type_t cb_type, bool rank_all, float clip_p, bool no_predict, size_t feature_width_above,
-      bool per_model_save_load, VW::workspace* all)
+      bool per_model_save_load, VW::workspace* all, size_t action_shortlist = 0)
       : _no_predict(no_predict)
       , _rank_all(rank_all)
       , _clip_p(clip_p)
       , _gen_cs_mtr(feature_width_above)
       , _cb_type(cb_type)
       , _per_model_save_load(per_model_save_load)
+      , _action_shortlist(action_shortlist)
       , _all(all)
   {
   }
@@ -67,6 +68,8 @@ private:
   void learn_sm(VW::LEARNER::learner& base, VW::multi_ex& examples);
   template <bool predict>
   void learn_mtr(VW::LEARNER::learner& base, VW::multi_ex& examples);
+  void predict_shortlist(VW::LEARNER::learner& base, VW::multi_ex& examples);
+  float linear_score(const VW::example& ec) const;
 
   std::vector<VW::cb_label> _cb_labels;
   VW::cs_label _cs_labels;
@@ -88,6 +91,13 @@ private:
   VW::cb_type_t _cb_type;
   bool _per_model_save_load;
 
+  // When predicting for more than _action_shortlist actions, only the _action_shortlist actions with the lowest
+  // linear_score are predicted by the base learner, and the others are left out of the ranking. 0 predicts every
+  // action.
+  size_t _action_shortlist;
+  VW::action_scores _linear_scores;  // temporary storage for predict_shortlist
+  VW::multi_ex _shortlist;           // temporary storage for predict_shortlist
+
   VW::workspace* _all = nullptr;
 };
 }  // namespace reductions
@@ -3,9 +3,11 @@
 // license as described in the file LICENSE.
 #pragma once
 
+#include "vw/core/action_score.h"
 #include "vw/core/estimators/confidence_sequence_robust.h"
 #include "vw/core/io_buf.h"
 #include "vw/core/learner_fwd.h"
+#include "vw/core/learner_replicas.h"
 #include "vw/core/vw_fwd.h"
 
 #include <memory>
@@ -30,7 +32,7 @@ public:
       double epsilon_decay_estimator_decay, dense_parameters& weights, std::string epsilon_decay_audit_str,
       bool constant_epsilon, uint32_t& feature_width, uint64_t _min_champ_examples, float initial_epsilon,
       uint64_t shift_model_bounds, bool reward_as_cost, double tol_x, bool is_brentq, bool predict_only_model,
-      bool challenger_epsilon);
+      bool challenger_epsilon, VW::workspace* all = nullptr, uint64_t ensemble_threads = 0);
   void update_weights(float init_ep, VW::LEARNER::learner& base, VW::multi_ex& examples);
   void promote_model(int64_t model_ind, int64_t swap_dist);
   void rebalance_greater_models(int64_t model_ind, int64_t swap_dist, int64_t model_count);
@@ -57,6 +59,14 @@ public:
   bool _reward_as_cost;
   bool _predict_only_model;
   bool _challenger_epsilon;
+  VW::workspace* _all;
+  // Number of replicas of the base learner which learn models alongside the learning thread, see learner_replicas.h.
+  uint64_t _ensemble_threads;
+  std::unique_ptr<VW::details::learner_replicas> _replicas;
+  std::vector<VW::action_scores> _model_preds;
+
+private:
+  void learn_models_in_parallel(float init_ep, VW::LEARNER::learner& base, VW::multi_ex& examples);
 };
 
 }  // namespace epsilon_decay
@@ -16,6 +16,7 @@
 #include "vw/core/vw_fwd.h"
 
 #include <memory>
+#include <vector>
 
 namespace VW
 {
@@ -52,6 +53,8 @@ public:
   void (*update)(gd&, VW::example&) = nullptr;
   float (*sensitivity)(gd&, VW::example&) = nullptr;
   void (*multipredict)(gd&, VW::example&, size_t, size_t, VW::polyprediction*, bool) = nullptr;
+  void (*predict_batch)(gd&, VW::multi_ex&) = nullptr;
+  std::vector<float> multipredict_scores;  // scratch space of multipredict with dense weights
   bool adaptive_input = false;
   bool normalized_input = false;
   bool adax = false;
@@ -113,7 +116,8 @@ inline void vec_add_multipredict(multipredict_info<T>& mp, const float fx, uint6
 }  // namespace details
 
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_weight)
-template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT)>
+// PrefetchDistance > 0 prefetches dense weights ahead of FuncT, see VW::details::WEIGHT_PREFETCH_DISTANCE
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), size_t PrefetchDistance = 0>
 inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat)
 {
   return all.weights.sparse
@@ -121,14 +125,15 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat)
             all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
             *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, dat,
             all.runtime_state.generate_interactions_object_cache_state)
-      : foreach_feature<DataT, WeightOrIndexT, FuncT, VW::dense_parameters>(all.weights.dense_weights,
-            all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
-            *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, dat,
+      : foreach_feature<DataT, WeightOrIndexT, FuncT, VW::dense_parameters, PrefetchDistance>(
+            all.weights.dense_weights, all.feature_tweaks_config.ignore_some_linear,
+            all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
+            all.feature_tweaks_config.permutations, ec, dat,
             all.runtime_state.generate_interactions_object_cache_state);
 }
 
 // iterate through one namespace (or its part), callback function FuncT(some_data_R, feature_value_x, feature_weight)
-template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT)>
+template <class DataT, class WeightOrIndexT, void (*FuncT)(DataT&, float, WeightOrIndexT), size_t PrefetchDistance = 0>
 inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat, size_t& num_interacted_features)
 {
   return all.weights.sparse
@@ -136,18 +141,19 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat, siz
             all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
             *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, dat, num_interacted_features,
             all.runtime_state.generate_interactions_object_cache_state)
-      : foreach_feature<DataT, WeightOrIndexT, FuncT, VW::dense_parameters>(all.weights.dense_weights,
-            all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
-            *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, dat, num_interacted_features,
+      : foreach_feature<DataT, WeightOrIndexT, FuncT, VW::dense_parameters, PrefetchDistance>(
+            all.weights.dense_weights, all.feature_tweaks_config.ignore_some_linear,
+            all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
+            all.feature_tweaks_config.permutations, ec, dat, num_interacted_features,
             all.runtime_state.generate_interactions_object_cache_state);
 }
 
 // iterate through all namespaces and quadratic&cubic features, callback function T(some_data_R, feature_value_x,
 // feature_weight)
-template <class DataT, void (*FuncT)(DataT&, float, float&)>
+template <class DataT, void (*FuncT)(DataT&, float, float&), size_t PrefetchDistance = 0>
 inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat)
 {
-  foreach_feature<DataT, float&, FuncT>(all, ec, dat);
+  foreach_feature<DataT, float&, FuncT, PrefetchDistance>(all, ec, dat);
 }
 
 template <class DataT, void (*FuncT)(DataT&, float, float)>
@@ -156,10 +162,10 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat)
   foreach_feature<DataT, float, FuncT>(all, ec, dat);
 }
 
-template <class DataT, void (*FuncT)(DataT&, float, float&)>
+template <class DataT, void (*FuncT)(DataT&, float, float&), size_t PrefetchDistance = 0>
 inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat, size_t& num_interacted_features)
 {
-  foreach_feature<DataT, float&, FuncT>(all, ec, dat, num_interacted_features);
+  foreach_feature<DataT, float&, FuncT, PrefetchDistance>(all, ec, dat, num_interacted_features);
 }
 
 template <class DataT, void (*FuncT)(DataT&, float, const float&)>
@@ -168,6 +174,7 @@ inline void foreach_feature(VW::workspace& all, VW::example& ec, DataT& dat, siz
   foreach_feature<DataT, const float&, FuncT>(all, ec, dat, num_interacted_features);
 }
 
+// Dense weights are prefetched ahead of the features being summed, see VW::details::WEIGHT_PREFETCH_DISTANCE
 inline float inline_predict(VW::workspace& all, VW::example& ec)
 {
   const auto& simple_red_features = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>();
@@ -176,10 +183,10 @@ inline float inline_predict(VW::workspace& all, VW::example& ec)
             all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
             all.feature_tweaks_config.permutations, ec, all.runtime_state.generate_interactions_object_cache_state,
             simple_red_features.initial)
-      : inline_predict<VW::dense_parameters>(all.weights.dense_weights, all.feature_tweaks_config.ignore_some_linear,
-            all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
-            all.feature_tweaks_config.permutations, ec, all.runtime_state.generate_interactions_object_cache_state,
-            simple_red_features.initial);
+      : inline_predict<VW::dense_parameters, VW::details::WEIGHT_PREFETCH_DISTANCE>(all.weights.dense_weights,
+            all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
+            *ec.extent_interactions, all.feature_tweaks_config.permutations, ec,
+            all.runtime_state.generate_interactions_object_cache_state, simple_red_features.initial);
 }
 
 inline float inline_predict(VW::workspace& all, VW::example& ec, size_t& num_generated_features)
@@ -190,9 +197,9 @@ inline float inline_predict(VW::workspace& all, VW::example& ec, size_t& num_gen
             all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
             all.feature_tweaks_config.permutations, ec, num_generated_features,
             all.runtime_state.generate_interactions_object_cache_state, simple_red_features.initial)
-      : inline_predict<VW::dense_parameters>(all.weights.dense_weights, all.feature_tweaks_config.ignore_some_linear,
-            all.feature_tweaks_config.ignore_linear, *ec.interactions, *ec.extent_interactions,
-            all.feature_tweaks_config.permutations, ec, num_generated_features,
+      : inline_predict<VW::dense_parameters, VW::details::WEIGHT_PREFETCH_DISTANCE>(all.weights.dense_weights,
+            all.feature_tweaks_config.ignore_some_linear, all.feature_tweaks_config.ignore_linear, *ec.interactions,
+            *ec.extent_interactions, all.feature_tweaks_config.permutations, ec, num_generated_features,
             all.runtime_state.generate_interactions_object_cache_state, simple_red_features.initial);
 }
 
@@ -0,0 +1,50 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#pragma once
+
+#include "vw/core/feature_group.h"
+#include "vw/core/multi_ex.h"
+#include "vw/core/v_array.h"
+#include "vw/core/vw_fwd.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace VW
+{
+namespace shared_feature_merger
+{
+/*
+ * Namespaces of a shared example which shared_feature_merger did not copy into the actions of a multi_ex it predicts,
+ * because none of the actions has them. gd lends them to each action while it is predicted, so that interactions with
+ * them are still generated, and adds the linear score of their features, which it computes once for each ft_offset.
+ */
+class shared_score
+{
+public:
+  VW::multi_ex::value_type shared_example = nullptr;
+  VW::v_array<VW::namespace_index> namespaces;
+  // Linear score of namespaces by ft_offset. The weights do not change while a multi_ex is predicted.
+  std::vector<std::pair<uint64_t, float>> linear_scores;
+
+  void reset(VW::multi_ex::value_type shared)
+  {
+    shared_example = shared;
+    namespaces.clear();
+    linear_scores.clear();
+  }
+};
+
+class reduction_features
+{
+public:
+  shared_score* shared = nullptr;
+
+  void clear() { shared = nullptr; }
+};
+
+}  // namespace shared_feature_merger
+}  // namespace VW
@@ -8,7 +8,6 @@
 #include <atomic>
 #include <functional>
 #include <future>
-#include <limits>
 #include <memory>
 #include <queue>
 #include <thread>
@@ -37,9 +36,11 @@ private:
 class thread_pool
 {
 public:
-  // Initializes a thread pool with num_threads threads.
-  explicit thread_pool(size_t num_threads)
-      : _done{false}, _task_queue{std::numeric_limits<size_t>::max()}, _joiner{_threads}
+  static constexpr size_t DEFAULT_MAX_QUEUED_TASKS = 1024;
+
+  // Initializes a thread pool with num_threads threads. submit blocks while max_queued_tasks tasks are waiting.
+  explicit thread_pool(size_t num_threads, size_t max_queued_tasks = DEFAULT_MAX_QUEUED_TASKS)
+      : _done{false}, _task_queue{max_queued_tasks}, _joiner{_threads}
   {
     try
     {
@@ -98,7 +99,7 @@ private:
   }
 
   std::atomic_bool _done;
-  VW::thread_safe_queue<std::function<void()>> _task_queue;
+  VW::ring_queue<std::function<void()>> _task_queue;
   std::vector<std::thread> _threads;
   threads_joiner _joiner;
 };
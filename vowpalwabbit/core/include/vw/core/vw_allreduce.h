@@ -33,6 +33,13 @@ void all_reduce(VW::workspace& all, T* buffer, const size_t n)
       all_reduce_threads_ptr->all_reduce<T, f>(buffer, n);
       break;
     }
+    case all_reduce_type::SOCKET_RING:
+    {
+      auto* all_reduce_ring_ptr = dynamic_cast<all_reduce_ring_sockets*>(all.runtime_state.all_reduce.get());
+      if (all_reduce_ring_ptr == nullptr) { THROW("all_reduce was not a all_reduce_ring_sockets* object") }
+      all_reduce_ring_ptr->all_reduce<T, f>(buffer, n, all.logger);
+      break;
+    }
   }
 }
 }  // namespace details
@@ -13,12 +13,247 @@ Alekh Agarwal and John Langford, with help Olivier Chapelle.
 #include "vw/core/global_data.h"
 #include "vw/core/vw_allreduce.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 static void add_float(float& c1, const float& c2) { c1 += c2; }
 
+namespace
+{
+constexpr size_t BLOCK_SIZE = VW::details::COMPRESSED_ALL_REDUCE_BLOCK_SIZE;
+
+void or_mask(uint64_t& c1, const uint64_t& c2) { c1 |= c2; }
+
+// Rounds to the nearest half precision value. Values out of range saturate, the residual carries the remainder.
+uint16_t float_to_half(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xff) - 127 + 15;
+  uint32_t mantissa = bits & 0x7fffff;
+
+  if (exponent >= 31) { return sign | 0x7bff; }
+  if (exponent <= 0)
+  {
+    if (exponent < -10) { return sign; }
+    // Subnormal half, the implicit leading one becomes explicit.
+    mantissa |= 0x800000;
+    const auto shift = static_cast<uint32_t>(14 - exponent);
+    uint32_t half_mantissa = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half_mantissa & 1) != 0)) { half_mantissa++; }
+    return static_cast<uint16_t>(sign | half_mantissa);
+  }
+
+  uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  const uint32_t remainder = mantissa & 0x1fff;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0)) { half++; }
+  if (half >= 0x7c00) { half = 0x7bff; }
+  return static_cast<uint16_t>(sign | half);
+}
+
+float half_to_float(uint16_t value)
+{
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1f;
+  const uint32_t mantissa = value & 0x3ff;
+  if (exponent == 0)
+  {
+    const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+    return sign != 0 ? -magnitude : magnitude;
+  }
+
+  const uint32_t bits = sign | (exponent == 31 ? 0x7f800000 : (exponent + 127 - 15) << 23) | (mantissa << 13);
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+void add_half(uint16_t& c1, const uint16_t& c2) { c1 = float_to_half(half_to_float(c1) + half_to_float(c2)); }
+
+class int8_block
+{
+public:
+  float scale;
+  int8_t values[BLOCK_SIZE];
+};
+
+void quantize(const float* values, int8_block& block)
+{
+  float max_abs = 0.f;
+  for (size_t i = 0; i < BLOCK_SIZE; i++) { max_abs = std::max(max_abs, std::fabs(values[i])); }
+  block.scale = max_abs / 127.f;
+  for (size_t i = 0; i < BLOCK_SIZE; i++)
+  {
+    block.values[i] = block.scale > 0.f ? static_cast<int8_t>(std::lround(values[i] / block.scale)) : 0;
+  }
+}
+
+void dequantize(const int8_block& block, float* values)
+{
+  for (size_t i = 0; i < BLOCK_SIZE; i++) { values[i] = block.scale * block.values[i]; }
+}
+
+void add_int8_block(int8_block& c1, const int8_block& c2)
+{
+  float sum[BLOCK_SIZE];
+  for (size_t i = 0; i < BLOCK_SIZE; i++) { sum[i] = c1.scale * c1.values[i] + c2.scale * c2.values[i]; }
+  quantize(sum, c1);
+}
+
+// Computes what each node will contribute to the weighted average of an entry it does not train on before the next
+// sync. This repeats the arithmetic of do_weighting so that the result matches it exactly.
+void expected_weighted_contribution(const VW::details::compressed_all_reduce_buffer& adaptive_weights,
+    size_t normalized_idx, float total, uint32_t stride_shift, std::vector<float>& weights)
+{
+  for (size_t i = 0; i < adaptive_weights.expected.size(); i++)
+  {
+    float* weight = &weights[i << stride_shift];
+    const float weight_sum = total * adaptive_weights.expected[i];
+    if (weight_sum > 0)
+    {
+      const float ratio = weight[1] / weight_sum;
+      weight[0] *= ratio;
+      weight[1] *= ratio;
+      if (normalized_idx > 0) { weight[normalized_idx] *= ratio; }
+    }
+    else { weight[0] = 0; }
+  }
+}
+}  // namespace
+
+VW::details::all_reduce_compression VW::details::all_reduce_compression_from_string(VW::string_view str)
+{
+  if (str == "none") { return all_reduce_compression::NONE; }
+  if (str == "sparse") { return all_reduce_compression::SPARSE; }
+  if (str == "fp16") { return all_reduce_compression::FP16; }
+  if (str == "int8") { return all_reduce_compression::INT8; }
+  THROW("Unknown all_reduce_compression: " << str);
+}
+
+void VW::details::compressed_all_reduce_sum(
+    VW::workspace& all, compressed_all_reduce_buffer& buffer, float* values, size_t n)
+{
+  const auto compression = all.runtime_state.all_reduce_compression == nullptr
+      ? all_reduce_compression::NONE
+      : all.runtime_state.all_reduce_compression->compression;
+  if (compression == all_reduce_compression::NONE)
+  {
+    VW::details::all_reduce<float, add_float>(all, values, n);
+    return;
+  }
+
+  if (buffer.expected.size() != n)
+  {
+    buffer.expected.assign(n, 0.f);
+    buffer.residual.assign(n, 0.f);
+  }
+
+  // Agree on the blocks in which at least one node deviates from the expected contribution.
+  const size_t num_blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  std::vector<uint64_t> changed((num_blocks + 63) / 64, 0);
+  for (size_t block = 0; block < num_blocks; block++)
+  {
+    const size_t end = std::min(n, (block + 1) * BLOCK_SIZE);
+    for (size_t i = block * BLOCK_SIZE; i < end; i++)
+    {
+      if (values[i] != buffer.expected[i])
+      {
+        changed[block / 64] |= UINT64_ONE << (block % 64);
+        break;
+      }
+    }
+  }
+  VW::details::all_reduce<uint64_t, or_mask>(all, changed.data(), changed.size());
+
+  std::vector<size_t> selected;
+  for (size_t block = 0; block < num_blocks; block++)
+  {
+    if ((changed[block / 64] & (UINT64_ONE << (block % 64))) != 0) { selected.push_back(block); }
+  }
+
+  // Differences from the expected contribution of the selected blocks, packed and padded to whole blocks.
+  std::vector<float> deltas(selected.size() * BLOCK_SIZE, 0.f);
+  for (size_t k = 0; k < selected.size(); k++)
+  {
+    const size_t begin = selected[k] * BLOCK_SIZE;
+    const size_t end = std::min(n, begin + BLOCK_SIZE);
+    for (size_t i = begin; i < end; i++)
+    {
+      deltas[k * BLOCK_SIZE + i - begin] = values[i] - buffer.expected[i] + buffer.residual[i];
+    }
+  }
+
+  // Encode, keep what the encoding lost as the new residual of this node, then sum the encoded differences.
+  std::vector<float> sent(compression == all_reduce_compression::SPARSE ? 0 : deltas.size());
+  auto keep_residual = [&]()
+  {
+    for (size_t k = 0; k < selected.size(); k++)
+    {
+      const size_t begin = selected[k] * BLOCK_SIZE;
+      const size_t end = std::min(n, begin + BLOCK_SIZE);
+      for (size_t i = begin; i < end; i++)
+      {
+        const size_t j = k * BLOCK_SIZE + i - begin;
+        buffer.residual[i] = deltas[j] - sent[j];
+      }
+    }
+  };
+  switch (compression)
+  {
+    case all_reduce_compression::SPARSE:
+    {
+      VW::details::all_reduce<float, add_float>(all, deltas.data(), deltas.size());
+      break;
+    }
+    case all_reduce_compression::FP16:
+    {
+      std::vector<uint16_t> halves(deltas.size());
+      for (size_t j = 0; j < deltas.size(); j++)
+      {
+        halves[j] = float_to_half(deltas[j]);
+        sent[j] = half_to_float(halves[j]);
+      }
+      keep_residual();
+      VW::details::all_reduce<uint16_t, add_half>(all, halves.data(), halves.size());
+      for (size_t j = 0; j < deltas.size(); j++) { deltas[j] = half_to_float(halves[j]); }
+      break;
+    }
+    case all_reduce_compression::INT8:
+    {
+      std::vector<int8_block> blocks(selected.size());
+      for (size_t k = 0; k < selected.size(); k++)
+      {
+        quantize(&deltas[k * BLOCK_SIZE], blocks[k]);
+        dequantize(blocks[k], &sent[k * BLOCK_SIZE]);
+      }
+      keep_residual();
+      VW::details::all_reduce<int8_block, add_int8_block>(all, blocks.data(), blocks.size());
+      for (size_t k = 0; k < selected.size(); k++) { dequantize(blocks[k], &deltas[k * BLOCK_SIZE]); }
+      break;
+    }
+    case all_reduce_compression::NONE:
+      break;
+  }
+
+  const float total = static_cast<float>(all.runtime_state.all_reduce->total);
+  for (size_t i = 0; i < n; i++) { values[i] = total * buffer.expected[i]; }
+  for (size_t k = 0; k < selected.size(); k++)
+  {
+    const size_t begin = selected[k] * BLOCK_SIZE;
+    const size_t end = std::min(n, begin + BLOCK_SIZE);
+    for (size_t i = begin; i < end; i++)
+    {
+      values[i] += deltas[k * BLOCK_SIZE + i - begin];
+    }
+  }
+}
+
 void VW::details::accumulate(VW::workspace& all, parameters& weights, size_t offset)
 {
   uint64_t length = UINT64_ONE << all.initial_weights_config.num_bits;  // This is size of gradient
@@ -87,7 +322,15 @@ void VW::details::accumulate_avg(VW::workspace& all, parameters& weights, size_t
     }
   }
 
-  VW::details::all_reduce<float, add_float>(all, local_grad, length);  // TODO: modify to not use first()
+  auto* compression = all.runtime_state.all_reduce_compression.get();
+  if (compression != nullptr) { VW::details::compressed_all_reduce_sum(all, compression->weights, local_grad, length); }
+  else { VW::details::all_reduce<float, add_float>(all, local_grad, length); }  // TODO: modify to not use first()
+
+  if (compression != nullptr)
+  {
+    // Until the next sync every node that does not train on an entry contributes the average computed here.
+    for (uint64_t i = 0; i < length; i++) { compression->weights.expected[i] = local_grad[i] / numnodes; }
+  }
 
   if (weights.sparse)
   {
@@ -134,7 +377,12 @@ void VW::details::accumulate_weighted_avg(VW::workspace& all, parameters& weight
   }
 
   // First compute weights for averaging
-  VW::details::all_reduce<float, add_float>(all, local_weights, length);
+  auto* compression = all.runtime_state.all_reduce_compression.get();
+  if (compression != nullptr)
+  {
+    VW::details::compressed_all_reduce_sum(all, compression->adaptive_weights, local_weights, length);
+  }
+  else { VW::details::all_reduce<float, add_float>(all, local_weights, length); }
 
   if (weights.sparse)
   {
@@ -150,6 +398,20 @@ void VW::details::accumulate_weighted_avg(VW::workspace& all, parameters& weight
     delete[] local_weights;
     THROW("Sparse parameters not supported with parallel computation");
   }
+  else if (compression != nullptr)
+  {
+    const size_t num_weights = (static_cast<size_t>(length)) * (1ull << weights.stride_shift());
+    float* first = weights.dense_weights.first();
+    VW::details::compressed_all_reduce_sum(all, compression->weights, first, num_weights);
+
+    for (uint64_t i = 0; i < length; i++)
+    {
+      compression->adaptive_weights.expected[i] = first[(i << weights.stride_shift()) + 1];
+    }
+    compression->weights.expected.assign(first, first + num_weights);
+    expected_weighted_contribution(compression->adaptive_weights, all.initial_weights_config.normalized_idx,
+        static_cast<float>(all.runtime_state.all_reduce->total), weights.stride_shift(), compression->weights.expected);
+  }
   else
   {
     VW::details::all_reduce<float, add_float>(
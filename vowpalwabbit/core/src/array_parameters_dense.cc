@@ -4,13 +4,27 @@
 
 #include "vw/core/array_parameters_dense.h"
 
+#include "vw/common/vw_exception.h"
 #include "vw/core/memory.h"
 
 #include <cassert>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
 
 #ifndef _WIN32
+#  include <fcntl.h>
 #  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#ifdef __linux__
+#  include <linux/mempolicy.h>
+#  include <sys/syscall.h>
 #endif
 
 // It appears that on OSX MAP_ANONYMOUS is mapped to MAP_ANON
@@ -19,11 +33,173 @@
 #  define MAP_ANONYMOUS MAP_ANON
 #endif
 
-VW::dense_parameters::dense_parameters(size_t length, uint32_t stride_shift)
+#ifndef MAP_HUGE_SHIFT
+#  define MAP_HUGE_SHIFT 26
+#endif
+
+namespace
+{
+constexpr size_t HUGE_PAGE_2MB = static_cast<size_t>(1) << 21;
+constexpr size_t HUGE_PAGE_1GB = static_cast<size_t>(1) << 30;
+
+#ifdef __linux__
+// Reads a node list such as "0-3,6" from sysfs into a bit mask as expected by mbind.
+std::vector<unsigned long> online_numa_nodes()
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  if (!(file >> list)) { THROW("NUMA placement of the weights requires a kernel with NUMA support"); }
+
+  constexpr size_t BITS = sizeof(unsigned long) * 8;
+  std::vector<unsigned long> mask;
+  size_t pos = 0;
+  while (pos < list.size())
+  {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) { end = list.size(); }
+    const auto range = list.substr(pos, end - pos);
+    const auto dash = range.find('-');
+    const size_t first = std::stoul(range.substr(0, dash));
+    const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+    for (size_t node = first; node <= last; ++node)
+    {
+      if (mask.size() <= node / BITS) { mask.resize(node / BITS + 1, 0); }
+      mask[node / BITS] |= 1UL << (node % BITS);
+    }
+    pos = end + 1;
+  }
+  return mask;
+}
+
+void apply_numa_policy(void* data, size_t num_bytes, VW::numa_policy numa)
+{
+  long result = 0;
+  if (numa == VW::numa_policy::INTERLEAVE)
+  {
+    auto nodes = online_numa_nodes();
+    // The kernel ignores the last bit of maxnode.
+    const unsigned long max_node = nodes.size() * sizeof(unsigned long) * 8 + 1;
+    result = syscall(SYS_mbind, data, num_bytes, MPOL_INTERLEAVE, nodes.data(), max_node, 0);
+  }
+  else if (numa == VW::numa_policy::LOCAL)
+  {
+    result = syscall(SYS_mbind, data, num_bytes, MPOL_LOCAL, nullptr, 0, 0);
+  }
+  if (result != 0) { THROW("Failed to set the NUMA policy of the weights: " << std::strerror(errno)); }
+}
+#endif
+
+void prefault_pages(VW::weight* data, size_t num_bytes, size_t page_size)
+{
+  // The memory is already zero, writing a zero into each page only forces it to be backed.
+  auto* bytes = reinterpret_cast<volatile char*>(data);
+  for (size_t offset = 0; offset < num_bytes; offset += page_size) { bytes[offset] = 0; }
+}
+
+// Returns zeroed storage for float_count weights, allocated as requested by allocation. shared memory is visible to
+// child processes forked afterwards.
+std::shared_ptr<VW::weight> allocate_weights(
+    size_t float_count, const VW::dense_allocation_options& allocation, bool shared)
+{
+  const size_t num_bytes = float_count * sizeof(VW::weight);
+  if (allocation.is_default() && !shared)
+  {
     // memory allocated by calloc should be freed by C free()
-    : _begin(VW::details::calloc_mergable_or_throw<VW::weight>(length << stride_shift), free)
+    return std::shared_ptr<VW::weight>(VW::details::calloc_mergable_or_throw<VW::weight>(float_count), free);
+  }
+
+#ifdef _WIN32
+  _UNUSED(num_bytes);
+  THROW("Huge pages, NUMA placement and pre-faulting of the weights are not supported on Windows");
+#else
+  int flags = (shared ? MAP_SHARED : MAP_PRIVATE) | MAP_ANONYMOUS;
+  size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  switch (allocation.pages)
+  {
+    case VW::huge_pages::NONE:
+      break;
+    case VW::huge_pages::TRANSPARENT_2MB:
+      page_size = HUGE_PAGE_2MB;
+      break;
+#  ifdef MAP_HUGETLB
+    case VW::huge_pages::EXPLICIT_2MB:
+      flags |= MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+      page_size = HUGE_PAGE_2MB;
+      break;
+    case VW::huge_pages::EXPLICIT_1GB:
+      flags |= MAP_HUGETLB | (30 << MAP_HUGE_SHIFT);
+      page_size = HUGE_PAGE_1GB;
+      break;
+#  else
+    default:
+      THROW("Explicit huge pages for the weights are only supported on Linux");
+#  endif
+  }
+  // Huge page mappings must be a multiple of the page size.
+  const size_t mapped_bytes = (num_bytes + page_size - 1) / page_size * page_size;
+
+  void* data = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+  if (data == MAP_FAILED)
+  {
+    if ((flags & MAP_HUGETLB) != 0)
+    {
+      THROW("Failed to map " << mapped_bytes << " bytes of " << page_size
+                             << " byte huge pages for the weights. Reserve enough of them, for example through "
+                                "/sys/kernel/mm/hugepages, or decrease -b: "
+                             << std::strerror(errno));
+    }
+    THROW("Failed to map " << mapped_bytes << " bytes for the weights: " << std::strerror(errno));
+  }
+  std::shared_ptr<VW::weight> weights(
+      static_cast<VW::weight*>(data), [mapped_bytes](VW::weight* p) { munmap(p, mapped_bytes); });
+
+#  ifdef __linux__
+  if (allocation.pages == VW::huge_pages::TRANSPARENT_2MB && madvise(data, mapped_bytes, MADV_HUGEPAGE) != 0)
+  {
+    THROW("Failed to enable transparent huge pages for the weights: " << std::strerror(errno));
+  }
+  apply_numa_policy(data, mapped_bytes, allocation.numa);
+#  else
+  if (allocation.pages == VW::huge_pages::TRANSPARENT_2MB || allocation.numa != VW::numa_policy::DEFAULT)
+  {
+    THROW("Transparent huge pages and NUMA placement of the weights are only supported on Linux");
+  }
+#  endif
+
+  if (allocation.prefault) { prefault_pages(weights.get(), mapped_bytes, page_size); }
+  return weights;
+#endif
+}
+}  // namespace
+
+VW::huge_pages VW::huge_pages_from_string(VW::string_view str)
+{
+  if (str == "none") { return VW::huge_pages::NONE; }
+  if (str == "transparent") { return VW::huge_pages::TRANSPARENT_2MB; }
+  if (str == "2mb") { return VW::huge_pages::EXPLICIT_2MB; }
+  if (str == "1gb") { return VW::huge_pages::EXPLICIT_1GB; }
+  THROW("Unknown huge page setting: " << str);
+}
+
+VW::numa_policy VW::numa_policy_from_string(VW::string_view str)
+{
+  if (str == "default") { return VW::numa_policy::DEFAULT; }
+  if (str == "interleave") { return VW::numa_policy::INTERLEAVE; }
+  if (str == "local") { return VW::numa_policy::LOCAL; }
+  THROW("Unknown NUMA policy: " << str);
+}
+
+VW::dense_parameters::dense_parameters(size_t length, uint32_t stride_shift)
+    : dense_parameters(length, stride_shift, dense_allocation_options())
+{
+}
+
+VW::dense_parameters::dense_parameters(
+    size_t length, uint32_t stride_shift, const dense_allocation_options& allocation)
+    : _begin(allocate_weights(length << stride_shift, allocation, false))
     , _weight_mask((length << stride_shift) - 1)
     , _stride_shift(stride_shift)
+    , _allocation(allocation)
 {
 }
 
@@ -34,6 +210,7 @@ VW::dense_parameters& VW::dense_parameters::operator=(dense_parameters&& other)
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _allocation = other._allocation;
   return *this;
 }
 
@@ -42,6 +219,7 @@ VW::dense_parameters::dense_parameters(dense_parameters&& other) noexcept
   _begin = std::move(other._begin);
   _weight_mask = other._weight_mask;
   _stride_shift = other._stride_shift;
+  _allocation = other._allocation;
 }
 bool VW::dense_parameters::not_null() { return (_weight_mask > 0 && _begin != nullptr); }
 
@@ -51,6 +229,7 @@ VW::dense_parameters VW::dense_parameters::shallow_copy(const dense_parameters&
   return_val._begin = input._begin;
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
+  return_val._allocation = input._allocation;
   return return_val;
 }
 
@@ -58,13 +237,53 @@ VW::dense_parameters VW::dense_parameters::deep_copy(const dense_parameters& inp
 {
   dense_parameters return_val;
   auto length = input._weight_mask + 1;
-  return_val._begin.reset(VW::details::calloc_mergable_or_throw<VW::weight>(length), free);
+  return_val._begin = allocate_weights(length, input._allocation, false);
   return_val._weight_mask = input._weight_mask;
   return_val._stride_shift = input._stride_shift;
+  return_val._allocation = input._allocation;
   std::memcpy(return_val._begin.get(), input._begin.get(), length * sizeof(VW::weight));
   return return_val;
 }
 
+VW::dense_parameters VW::dense_parameters::map_file(
+    const std::string& file_name, uint64_t offset, size_t length, uint32_t stride_shift, bool read_only)
+{
+  const size_t float_count = length << stride_shift;
+  const size_t num_bytes = float_count * sizeof(VW::weight);
+  dense_parameters return_val;
+  return_val._weight_mask = float_count - 1;
+  return_val._stride_shift = stride_shift;
+
+#ifdef _WIN32
+  _UNUSED(read_only);
+  return_val._begin.reset(VW::details::calloc_mergable_or_throw<VW::weight>(float_count), free);
+  std::ifstream file(file_name, std::ios::binary);
+  file.seekg(static_cast<std::streamoff>(offset));
+  file.read(reinterpret_cast<char*>(return_val._begin.get()), static_cast<std::streamsize>(num_bytes));
+  if (!file) { THROW("Failed to read " << num_bytes << " bytes of weights at offset " << offset << " of " << file_name); }
+#else
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) { THROW("Failed to open " << file_name << " for mapping: " << std::strerror(errno)); }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || static_cast<uint64_t>(file_stat.st_size) < offset + num_bytes)
+  {
+    close(fd);
+    THROW("Model file " << file_name << " is too short to contain " << num_bytes << " bytes of weights at offset "
+                        << offset);
+  }
+
+  const int protection = read_only ? PROT_READ : (PROT_READ | PROT_WRITE);
+  void* mapped = mmap(nullptr, num_bytes, protection, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+  // The mapping keeps its own reference to the file.
+  close(fd);
+  if (mapped == MAP_FAILED) { THROW("Failed to map weights of " << file_name << ": " << std::strerror(errno)); }
+
+  return_val._begin.reset(static_cast<VW::weight*>(mapped), [num_bytes](VW::weight* p) { munmap(p, num_bytes); });
+#endif
+  return return_val;
+}
+
 void VW::dense_parameters::set_zero(size_t offset)
 {
   if (not_null())
@@ -77,11 +296,8 @@ void VW::dense_parameters::set_zero(size_t offset)
 #  ifndef DISABLE_SHARED_WEIGHTS
 void VW::dense_parameters::share(size_t length)
 {
-  VW::weight* shared_weights = static_cast<VW::weight*>(mmap(nullptr, (length << _stride_shift) * sizeof(VW::weight),
-      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
   size_t float_count = length << _stride_shift;
-  std::shared_ptr<VW::weight> dest(
-      shared_weights, [shared_weights, float_count](void*) { munmap(shared_weights, float_count); });
+  auto dest = allocate_weights(float_count, _allocation, true);
   memcpy(dest.get(), _begin.get(), float_count * sizeof(VW::weight));
   _begin = dest;
 }
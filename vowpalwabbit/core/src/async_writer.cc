@@ -0,0 +1,108 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/async_writer.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/common/vw_throw.h"
+
+VW::details::async_writer::async_writer(std::unique_ptr<VW::io::writer> inner, size_t buffer_size,
+    size_t max_pending_buffers, std::chrono::milliseconds flush_interval)
+    : _inner(std::move(inner))
+    , _buffer_size(buffer_size)
+    , _flush_interval(flush_interval)
+    , _last_hand_off(std::chrono::steady_clock::now())
+    , _current(new pending_buffer())
+    , _pending(max_pending_buffers)
+{
+  _current->data.reserve(_buffer_size);
+  _writer_thread = std::thread(&async_writer::write_buffers, this);
+}
+
+VW::details::async_writer::~async_writer()
+{
+  hand_off(true);
+  _pending.set_done();
+  _writer_thread.join();
+}
+
+ssize_t VW::details::async_writer::write(const char* buffer, size_t num_bytes)
+{
+  if (_failed.load(std::memory_order_acquire)) { rethrow_error(); }
+
+  _current->data.insert(_current->data.end(), buffer, buffer + num_bytes);
+  if (_current->data.size() >= _buffer_size) { hand_off(false); }
+  else if (_flush_interval.count() > 0 && std::chrono::steady_clock::now() - _last_hand_off >= _flush_interval)
+  {
+    hand_off(false);
+  }
+  return static_cast<ssize_t>(num_bytes);
+}
+
+void VW::details::async_writer::flush()
+{
+  hand_off(true);
+  const uint64_t requested = ++_flushes_requested;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _flush_done.wait(lock, [this, requested] { return _flushes_done >= requested; });
+  }
+  if (_failed.load(std::memory_order_acquire)) { rethrow_error(); }
+}
+
+void VW::details::async_writer::hand_off(bool flush)
+{
+  _current->flush = flush;
+  // Blocks while the writer thread is max_pending_buffers behind.
+  _pending.push(std::move(_current));
+  _current.reset(new pending_buffer());
+  _current->data.reserve(_buffer_size);
+  _last_hand_off = std::chrono::steady_clock::now();
+}
+
+void VW::details::async_writer::write_buffers()
+{
+  std::unique_ptr<pending_buffer> buffer;
+  while (_pending.try_pop(buffer))
+  {
+    // After an error the remaining output is dropped, but flushes are still signalled so that flush does not hang.
+    if (!_failed.load(std::memory_order_relaxed))
+    {
+      try
+      {
+        const char* data = buffer->data.data();
+        size_t remaining = buffer->data.size();
+        while (remaining > 0)
+        {
+          const ssize_t written = _inner->write(data, remaining);
+          if (written <= 0) { THROW("Failed to write output"); }
+          data += written;
+          remaining -= static_cast<size_t>(written);
+        }
+        if (buffer->flush) { _inner->flush(); }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _error = std::current_exception();
+        _failed.store(true, std::memory_order_release);
+      }
+    }
+
+    if (buffer->flush)
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _flushes_done++;
+      }
+      _flush_done.notify_all();
+    }
+  }
+}
+
+void VW::details::async_writer::rethrow_error()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::rethrow_exception(_error);
+}
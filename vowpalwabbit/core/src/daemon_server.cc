@@ -0,0 +1,682 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/daemon_server.h"
+
+#include "vw/cache_parser/parse_example_cache.h"
+#include "vw/common/vw_exception.h"
+#include "vw/config/cli_options_serializer.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/daemon_utils.h"
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/io_buf.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/parse_primitives.h"
+#include "vw/core/parser.h"
+#include "vw/core/queue.h"
+#include "vw/core/scope_exit.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/vw.h"
+#include "vw/io/errno_handling.h"
+#include "vw/io/io_adapter.h"
+#include "vw/io/logger.h"
+#include "vw/text_parser/parse_example_text.h"
+
+#ifdef __linux__
+#  include <fcntl.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <sys/epoll.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+namespace
+{
+constexpr size_t READ_CHUNK_SIZE = 1 << 16;
+// Input read from one connection before its lines are processed, so that one client cannot hold on to a worker.
+constexpr size_t MAX_INPUT_PER_TURN = 1 << 20;
+// Received input which does not complete an example yet. A connection which sends more is closed.
+constexpr size_t MAX_PENDING_INPUT = 1 << 24;
+// Examples are large even with few features, so the input of a turn is parsed and run in batches of this many
+// examples. A multiline example is never split across batches.
+constexpr size_t MAX_EXAMPLES_PER_BATCH = 256;
+constexpr int MAX_EVENTS = 64;
+// The event loop wakes up at least this often to check whether it has to stop.
+constexpr int STOP_CHECK_INTERVAL_MS = 500;
+constexpr size_t MAX_QUEUED_CONNECTIONS = 1024;
+
+volatile std::sig_atomic_t stop_requested = 0;
+volatile std::sig_atomic_t reload_requested = 0;
+
+void handle_stop(int) { stop_requested = 1; }
+void handle_reload(int) { reload_requested = 1; }
+
+// Options of the served workspace which are not passed on to a reloaded model, because they control where input comes
+// from and where output goes rather than how the model is set up.
+const std::set<std::string> RELOAD_IGNORED_OPTIONS = {"data", "no_stdin", "initial_regressor", "final_regressor",
+    "readable_model", "invert_hash", "predictions", "raw_predictions", "cache", "cache_file", "kill_cache", "daemon",
+    "foreground", "port", "num_children", "pid_file", "port_file", "daemon_threads", "no_daemon", "quiet"};
+
+enum class wire_format
+{
+  UNKNOWN,
+  TEXT,
+  BINARY
+};
+
+// The model clients are served with. A reload builds a new generation and publishes it, workers keep the generation
+// they started a request with alive until they are done with it.
+class model_generation
+{
+public:
+  // The reloaded model, nullptr for the workspace the server was started with.
+  std::unique_ptr<VW::workspace> model;
+  // The workspace of every worker in test only mode, empty when training.
+  std::vector<std::unique_ptr<VW::workspace>> workers;
+};
+
+class connection
+{
+public:
+  explicit connection(int fd) : fd(fd) {}
+  ~connection() { close(fd); }
+  connection(const connection&) = delete;
+  connection& operator=(const connection&) = delete;
+
+  int fd;
+  // Decided by the first byte received.
+  wire_format format = wire_format::UNKNOWN;
+  // Received bytes which have not been processed yet, this always starts at the beginning of a line or binary example.
+  std::string input;
+  // Bytes at the start of input which have been parsed into examples.
+  size_t parsed = 0;
+  // Text input between parsed and scanned has no line break.
+  size_t scanned = 0;
+  // Examples parsed from input. They belong to the connection rather than to the pool of a workspace, so that the
+  // examples of an unterminated multiline example can be kept until the rest of it arrives, whichever worker serves
+  // the connection then.
+  std::vector<std::unique_ptr<VW::example>> examples;
+  // The model the examples were parsed for.
+  std::weak_ptr<model_generation> parsed_generation;
+  // Responses after output_sent have not been taken by the socket yet. No more input is read from a client until it
+  // has read its earlier responses, so a client which stops reading does not hold on to a worker.
+  std::shared_ptr<std::vector<char>> output = std::make_shared<std::vector<char>>();
+  size_t output_sent = 0;
+  // Set once the client has closed its side of the connection.
+  bool input_closed = false;
+};
+
+class worker
+{
+public:
+  size_t index = 0;
+  std::vector<VW::string_view> words;
+  VW::label_parser_reuse_mem reuse_mem;
+  // Reads the binary examples received on a connection.
+  VW::io_buf records;
+  VW::multi_ex record;
+  // Number of examples in each complete multiline example of the current batch.
+  std::vector<size_t> group_sizes;
+  // Examples which are not in use, handed to connections as they parse input.
+  std::vector<std::unique_ptr<VW::example>> spare_examples;
+  // Raw predictions of a test only worker which are not copied to the file of the served workspace yet.
+  std::shared_ptr<std::vector<char>> raw_output = std::make_shared<std::vector<char>>();
+};
+
+class server
+{
+public:
+  explicit server(VW::workspace& all) : all(all), ready(MAX_QUEUED_CONNECTIONS) {}
+
+  VW::workspace& all;
+  int epoll_fd = -1;
+  bool multiline = false;
+  // Serializes all use of the shared workspace.
+  std::mutex learner_lock;
+  VW::ring_queue<connection*> ready;
+  std::mutex connections_lock;
+  std::unordered_map<int, std::unique_ptr<connection>> connections;
+  // Only accessed through std::atomic_load and std::atomic_store.
+  std::shared_ptr<model_generation> generation;
+  std::thread reloader;
+  std::atomic<bool> reloading{false};
+};
+
+std::shared_ptr<model_generation> make_generation(VW::workspace& model, size_t num_workers)
+{
+  auto generation = std::make_shared<model_generation>();
+  if (model.runtime_config.training) { return generation; }
+
+  for (size_t i = 0; i < num_workers; i++)
+  {
+    auto workspace = VW::seed_vw_model(model, {"--no_daemon"});
+    // Statistics are updated while predicting, so every worker keeps its own and does not report them.
+    workspace->sd = std::make_shared<VW::shared_data>(*model.sd);
+    workspace->output_config.quiet = true;
+    // The worker opened the prediction files of the served workspace again. Its predictions are copied to the files of
+    // the served workspace instead, see copy_predictions.
+    workspace->output_runtime.final_prediction_sink.clear();
+    workspace->output_runtime.raw_prediction.reset();
+    generation->workers.push_back(std::move(workspace));
+  }
+  return generation;
+}
+
+// Loads file into a new workspace set up with the same options as all.
+std::unique_ptr<VW::workspace> load_model(VW::workspace& all, const std::string& file)
+{
+  VW::config::cli_options_serializer serializer;
+  for (auto const& option : all.options->get_all_options())
+  {
+    if (all.options->was_supplied(option->m_name) && RELOAD_IGNORED_OPTIONS.count(option->m_name) == 0)
+    {
+      serializer.add(*option);
+    }
+  }
+  auto args = VW::split_command_line(serializer.str());
+  args.insert(args.end(), {"--no_stdin", "--quiet", "-i", file});
+  return VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+}
+
+// Runs on the reloader thread, so that clients continue to be served by the old model while the new one is loaded.
+void reload(server& s, const std::string& file, size_t num_workers)
+{
+  try
+  {
+    auto model = load_model(s.all, file);
+    auto generation = make_generation(*model, num_workers);
+    if (s.all.runtime_config.training)
+    {
+      // Learning continues from the reloaded weights.
+      std::lock_guard<std::mutex> lock(s.learner_lock);
+      s.all.weights.shallow_copy(model->weights);
+    }
+    generation->model = std::move(model);
+    std::atomic_store(&s.generation, std::shared_ptr<model_generation>(std::move(generation)));
+
+    std::lock_guard<std::mutex> lock(s.learner_lock);
+    if (!s.all.output_config.quiet) { *(s.all.output_runtime.trace_message) << "reloaded " << file << std::endl; }
+  }
+  catch (const std::exception& e)
+  {
+    std::lock_guard<std::mutex> lock(s.learner_lock);
+    s.all.logger.err_error("Failed to reload {}, continuing with the current model: {}", file, e.what());
+  }
+  s.reloading = false;
+}
+
+void start_reload(server& s, size_t num_workers)
+{
+  if (s.all.initial_weights_config.initial_regressors.empty())
+  {
+    s.all.logger.err_warn("Ignoring reload request since the daemon was not started with -i");
+    return;
+  }
+  if (s.reloading)
+  {
+    s.all.logger.err_warn("Ignoring reload request since a reload is in progress");
+    return;
+  }
+
+  if (s.reloader.joinable()) { s.reloader.join(); }
+  s.reloading = true;
+  const auto file = s.all.initial_weights_config.initial_regressors[0];
+  s.reloader = std::thread([&s, file, num_workers]() { reload(s, file, num_workers); });
+}
+
+void set_non_blocking(int fd)
+{
+  int flags = fcntl(fd, F_GETFL, 0);
+  if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) THROWERRNO("fcntl");
+}
+
+// Connections are registered one shot so that only one worker at a time handles a connection, which keeps the
+// responses in order. The worker rearms the connection when it is done with it, to wait for the client to read if some
+// responses are still unsent.
+void watch(server& s, connection& conn, int operation)
+{
+  epoll_event event;
+  event.events = (conn.output_sent < conn.output->size() ? EPOLLOUT : EPOLLIN | EPOLLRDHUP) | EPOLLONESHOT;
+  event.data.ptr = &conn;
+  if (epoll_ctl(s.epoll_fd, operation, conn.fd, &event) < 0) THROWERRNO("epoll_ctl");
+}
+
+void close_connection(server& s, connection& conn)
+{
+  std::lock_guard<std::mutex> lock(s.connections_lock);
+  // Closing the descriptor also removes it from the epoll set.
+  s.connections.erase(conn.fd);
+}
+
+void accept_connections(server& s)
+{
+  const int listen_sock = s.all.parser_runtime.example_parser->bound_sock;
+  while (true)
+  {
+    const int fd = accept(listen_sock, nullptr, nullptr);
+    if (fd < 0)
+    {
+      if (errno == EINTR) { continue; }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) { return; }
+      THROWERRNO("accept");
+    }
+
+    // Disable Nagle delay algorithm due to daemon mode's interactive workload
+    int one = 1;
+    setsockopt(fd, SOL_TCP, TCP_NODELAY, reinterpret_cast<char*>(&one), sizeof(one));
+    auto conn = VW::make_unique<connection>(fd);
+    set_non_blocking(fd);
+    auto* conn_ptr = conn.get();
+    {
+      std::lock_guard<std::mutex> lock(s.connections_lock);
+      s.connections[fd] = std::move(conn);
+    }
+    watch(s, *conn_ptr, EPOLL_CTL_ADD);
+  }
+}
+
+// Returns false once the client has closed its side of the connection.
+bool receive(connection& conn)
+{
+  char buffer[READ_CHUNK_SIZE];
+  size_t received = 0;
+  while (received < MAX_INPUT_PER_TURN)
+  {
+    const auto read_size = recv(conn.fd, buffer, sizeof(buffer), 0);
+    if (read_size > 0)
+    {
+      conn.input.append(buffer, static_cast<size_t>(read_size));
+      received += static_cast<size_t>(read_size);
+    }
+    else if (read_size == 0) { return false; }
+    else if (errno == EAGAIN || errno == EWOULDBLOCK) { return true; }
+    else if (errno != EINTR) { return false; }
+  }
+  return true;
+}
+
+// Sends what the socket takes of the pending output of conn without blocking. Returns true once all of it is sent.
+bool send_output(connection& conn)
+{
+  auto& output = *conn.output;
+  while (conn.output_sent < output.size())
+  {
+    const auto write_size =
+        send(conn.fd, output.data() + conn.output_sent, output.size() - conn.output_sent, MSG_NOSIGNAL);
+    if (write_size >= 0) { conn.output_sent += static_cast<size_t>(write_size); }
+    else if (errno == EAGAIN || errno == EWOULDBLOCK) { return false; }
+    else if (errno != EINTR) { THROWERRNO("send"); }
+  }
+  output.clear();
+  conn.output_sent = 0;
+  return true;
+}
+
+VW::example* next_example(worker& w, connection& conn)
+{
+  if (w.spare_examples.empty()) { conn.examples.push_back(VW::make_unique<VW::example>()); }
+  else
+  {
+    conn.examples.push_back(std::move(w.spare_examples.back()));
+    w.spare_examples.pop_back();
+  }
+  return conn.examples.back().get();
+}
+
+// Clears the first count examples of conn and hands them back to w.
+void release_examples(VW::workspace& target, worker& w, connection& conn, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    VW::empty_example(target, *conn.examples[i]);
+    w.spare_examples.push_back(std::move(conn.examples[i]));
+  }
+  conn.examples.erase(conn.examples.begin(), conn.examples.begin() + count);
+}
+
+bool batch_full(const server& s, const connection& conn, size_t group_size)
+{
+  return conn.examples.size() >= MAX_EXAMPLES_PER_BATCH && (!s.multiline || group_size == 0);
+}
+
+// Parses the next batch of complete lines of conn.input after conn.parsed. The lines of a multiline example which is
+// not terminated by an empty line yet stay parsed on the connection, unless the client is gone. Returns the end of the
+// last complete example in conn.input, or 0 if there is none.
+size_t parse_text_input(server& s, worker& w, VW::workspace& target, connection& conn, bool at_end)
+{
+  size_t consumed = 0;
+  // Examples of an unterminated multiline example from earlier turns are at the start of conn.examples.
+  size_t group_size = conn.examples.size();
+  size_t begin = conn.parsed;
+  while (begin < conn.input.size() && !batch_full(s, conn, group_size))
+  {
+    size_t end = conn.input.find('\n', std::max(begin, conn.scanned));
+    if (end == std::string::npos)
+    {
+      conn.scanned = conn.input.size();
+      if (!at_end) { break; }
+      end = conn.input.size();
+    }
+
+    VW::string_view line(conn.input.data() + begin, end - begin);
+    begin = std::min(end + 1, conn.input.size());
+    if (s.multiline && line.empty())
+    {
+      if (group_size > 0) { w.group_sizes.push_back(group_size); }
+      group_size = 0;
+      consumed = begin;
+      continue;
+    }
+
+    VW::parsers::text::details::substring_to_example(&target, next_example(w, conn), line, w.words, w.reuse_mem);
+    group_size++;
+    if (!s.multiline) { consumed = begin; }
+  }
+  conn.parsed = begin;
+
+  if (s.multiline && at_end && group_size > 0)
+  {
+    w.group_sizes.push_back(group_size);
+    consumed = conn.input.size();
+  }
+  return consumed;
+}
+
+// Parses the next batch of complete examples of conn.input after conn.parsed, which are written by
+// write_example_to_cache and so start with their size. A newline example ends a multiline example, the examples of an
+// unterminated one stay parsed on the connection. Returns the end of the last complete example in conn.input, or 0 if
+// there is none.
+size_t parse_binary_input(server& s, worker& w, VW::workspace& target, connection& conn, bool at_end)
+{
+  w.records.close_files();
+  w.records.reset();
+  w.records.add_file(VW::io::create_buffer_view(conn.input.data() + conn.parsed, conn.input.size() - conn.parsed));
+
+  size_t consumed = 0;
+  size_t group_size = conn.examples.size();
+  size_t end = conn.parsed;
+  while (conn.input.size() - end >= sizeof(uint64_t) && !batch_full(s, conn, group_size))
+  {
+    uint64_t record_size = 0;
+    std::memcpy(&record_size, conn.input.data() + end, sizeof(uint64_t));
+    if (record_size > MAX_PENDING_INPUT - sizeof(uint64_t))
+    {
+      THROW("Binary example of " << record_size << " bytes is larger than the limit of "
+                                 << MAX_PENDING_INPUT - sizeof(uint64_t) << " bytes");
+    }
+    if (conn.input.size() - end - sizeof(uint64_t) < record_size) { break; }
+    end += sizeof(uint64_t) + static_cast<size_t>(record_size);
+
+    auto* ex = next_example(w, conn);
+    w.record.assign(1, ex);
+    VW::parsers::cache::read_example_from_cache(&target, w.records, w.record);
+    if (s.multiline && ex->is_newline)
+    {
+      VW::empty_example(target, *ex);
+      w.spare_examples.push_back(std::move(conn.examples.back()));
+      conn.examples.pop_back();
+      if (group_size > 0) { w.group_sizes.push_back(group_size); }
+      group_size = 0;
+      consumed = end;
+      continue;
+    }
+    group_size++;
+    if (!s.multiline) { consumed = end; }
+  }
+  conn.parsed = end;
+
+  if (s.multiline && at_end && group_size > 0)
+  {
+    w.group_sizes.push_back(group_size);
+    consumed = end;
+  }
+  return consumed;
+}
+
+// Learns from (or predicts) the first count examples of conn, which form complete examples, and appends the
+// predictions to conn.output.
+void run_examples(server& s, worker& w, VW::workspace& target, connection& conn, size_t count)
+{
+  // Predictions go to any regular sinks as well as back to the client, as with the forking daemon. The sinks of a test
+  // only worker are empty, its predictions are copied to those of all afterwards.
+  auto& sinks = target.output_runtime.final_prediction_sink;
+  sinks.push_back(VW::io::create_vector_writer(conn.output));
+  const bool collect_raw = &target != &s.all && s.all.output_runtime.raw_prediction != nullptr;
+  if (collect_raw)
+  {
+    w.raw_output->clear();
+    target.output_runtime.raw_prediction = VW::io::create_vector_writer(w.raw_output);
+  }
+  // Binary clients get scalar predictions in binary, target is not used by any other worker while running examples.
+  const auto print_by_ref = target.print_by_ref;
+  if (conn.format == wire_format::BINARY) { target.print_by_ref = VW::details::binary_print_result_by_ref; }
+  auto restore_output = VW::scope_exit(
+      [&]()
+      {
+        sinks.pop_back();
+        if (collect_raw) { target.output_runtime.raw_prediction.reset(); }
+        target.print_by_ref = print_by_ref;
+      });
+
+  if (s.multiline)
+  {
+    VW::multi_ex group;
+    size_t next = 0;
+    for (size_t size : w.group_sizes)
+    {
+      group.clear();
+      for (size_t i = next; i < next + size; i++) { group.push_back(conn.examples[i].get()); }
+      VW::setup_examples(target, group);
+      target.learn(group);
+      target.finish_example(group);
+      next += size;
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      auto* ex = conn.examples[i].get();
+      VW::setup_example(target, ex);
+      target.learn(*ex);
+      target.finish_example(*ex);
+    }
+  }
+}
+
+// Writes what a test only worker predicted to the prediction files of the served workspace: output from begin on, which
+// is what the client got, and the raw predictions collected in w.
+void copy_predictions(server& s, worker& w, const std::vector<char>& output, size_t begin)
+{
+  auto& sinks = s.all.output_runtime.final_prediction_sink;
+  auto& raw_prediction = s.all.output_runtime.raw_prediction;
+  if (sinks.empty() && raw_prediction == nullptr) { return; }
+
+  std::lock_guard<std::mutex> lock(s.learner_lock);
+  for (auto& sink : sinks) { sink->write(output.data() + begin, output.size() - begin); }
+  if (raw_prediction != nullptr)
+  {
+    raw_prediction->write(w.raw_output->data(), w.raw_output->size());
+    w.raw_output->clear();
+  }
+}
+
+// Handles the input that is available on a connection. Returns false when the connection should be closed.
+bool serve(server& s, worker& w, connection& conn)
+{
+  if (!send_output(conn)) { return true; }
+  if (conn.input_closed) { return false; }
+
+  const bool open = receive(conn);
+  conn.input_closed = !open;
+  if (conn.format == wire_format::UNKNOWN && !conn.input.empty())
+  {
+    // As with the forking daemon, text never starts with a zero byte.
+    conn.format = conn.input[0] == '\0' ? wire_format::BINARY : wire_format::TEXT;
+    if (conn.format == wire_format::BINARY) { conn.input.erase(0, 1); }
+  }
+  const auto generation = std::atomic_load(&s.generation);
+  const bool test_only = !generation->workers.empty();
+  VW::workspace& target = test_only ? *generation->workers[w.index] : s.all;
+
+  if (conn.parsed_generation.lock() != generation)
+  {
+    // A reloaded model may hash features differently, so an unterminated multiline example is parsed again.
+    release_examples(target, w, conn, conn.examples.size());
+    conn.parsed = 0;
+    conn.scanned = 0;
+    conn.parsed_generation = generation;
+  }
+
+  size_t consumed = 0;
+  while (true)
+  {
+    w.group_sizes.clear();
+    consumed = std::max(consumed,
+        conn.format == wire_format::BINARY ? parse_binary_input(s, w, target, conn, !open)
+                                           : parse_text_input(s, w, target, conn, !open));
+    const size_t count =
+        s.multiline ? std::accumulate(w.group_sizes.begin(), w.group_sizes.end(), size_t{0}) : conn.examples.size();
+    if (count == 0) { break; }
+
+    if (test_only)
+    {
+      const size_t output_begin = conn.output->size();
+      run_examples(s, w, target, conn, count);
+      copy_predictions(s, w, *conn.output, output_begin);
+    }
+    else
+    {
+      std::lock_guard<std::mutex> lock(s.learner_lock);
+      run_examples(s, w, target, conn, count);
+    }
+    release_examples(target, w, conn, count);
+  }
+  conn.input.erase(0, consumed);
+  conn.parsed -= consumed;
+  conn.scanned = conn.scanned > consumed ? conn.scanned - consumed : 0;
+
+  const bool sent = send_output(conn);
+  if (open && conn.input.size() > MAX_PENDING_INPUT)
+  {
+    THROW("Received more than " << MAX_PENDING_INPUT << " bytes without the end of an example");
+  }
+  // The connection stays open until the client has read the responses to all of its input.
+  return open || !sent;
+}
+
+void work(server& s, worker& w)
+{
+  connection* conn = nullptr;
+  while (s.ready.try_pop(conn))
+  {
+    bool keep_open = false;
+    try
+    {
+      keep_open = serve(s, w, *conn);
+      if (keep_open) { watch(s, *conn, EPOLL_CTL_MOD); }
+    }
+    catch (const std::exception& e)
+    {
+      std::lock_guard<std::mutex> lock(s.learner_lock);
+      s.all.logger.err_error("Closing daemon connection: {}", e.what());
+      keep_open = false;
+    }
+    if (!keep_open) { close_connection(s, *conn); }
+  }
+}
+}  // namespace
+
+void VW::details::run_threaded_daemon(VW::workspace& all)
+{
+  const size_t num_threads = all.parser_runtime.example_parser->daemon_threads;
+  server s(all);
+  s.multiline = all.l->is_multiline();
+  stop_requested = 0;
+  reload_requested = 0;
+
+  std::vector<worker> workers(num_threads);
+  for (size_t i = 0; i < num_threads; i++) { workers[i].index = i; }
+  std::atomic_store(&s.generation, make_generation(all, num_threads));
+
+  {
+    // Specifically don't set SA_RESTART so that epoll_wait is interrupted by SIGTERM and SIGHUP.
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = handle_stop;
+    sigaction(SIGTERM, &sa, nullptr);
+    sa.sa_handler = handle_reload;
+    sigaction(SIGHUP, &sa, nullptr);
+  }
+
+  s.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (s.epoll_fd < 0) THROWERRNO("epoll_create1");
+  const int listen_sock = all.parser_runtime.example_parser->bound_sock;
+  // enable_sources listens with a backlog of one since every forked child accepts a single connection.
+  if (listen(listen_sock, SOMAXCONN) < 0) THROWERRNO("listen");
+  set_non_blocking(listen_sock);
+  epoll_event listen_event;
+  listen_event.events = EPOLLIN;
+  listen_event.data.ptr = nullptr;
+  if (epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, listen_sock, &listen_event) < 0) THROWERRNO("epoll_ctl");
+
+  std::vector<std::thread> threads;
+  for (auto& w : workers) { threads.emplace_back([&s, &w]() { work(s, w); }); }
+
+  if (!all.output_config.quiet)
+  {
+    *(all.output_runtime.trace_message) << "serving daemon clients from " << num_threads << " threads" << std::endl;
+  }
+
+  epoll_event events[MAX_EVENTS];
+  while (stop_requested == 0)
+  {
+    if (reload_requested != 0)
+    {
+      reload_requested = 0;
+      std::lock_guard<std::mutex> lock(s.learner_lock);
+      start_reload(s, num_threads);
+    }
+
+    const int num_events = epoll_wait(s.epoll_fd, events, MAX_EVENTS, STOP_CHECK_INTERVAL_MS);
+    if (num_events < 0)
+    {
+      if (errno == EINTR) { continue; }
+      THROWERRNO("epoll_wait");
+    }
+
+    for (int i = 0; i < num_events; i++)
+    {
+      if (events[i].data.ptr == nullptr) { accept_connections(s); }
+      else { s.ready.push(static_cast<connection*>(events[i].data.ptr)); }
+    }
+  }
+
+  s.ready.set_done();
+  for (auto& thread : threads) { thread.join(); }
+  if (s.reloader.joinable()) { s.reloader.join(); }
+  s.connections.clear();
+  close(s.epoll_fd);
+}
+#else
+void VW::details::run_threaded_daemon(VW::workspace&) { THROW("--daemon_threads is only supported on Linux"); }
+#endif
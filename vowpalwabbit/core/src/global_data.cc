@@ -15,7 +15,9 @@
 #include "vw/common/string_view.h"
 #include "vw/common/vw_exception.h"
 #include "vw/config/options.h"
+#include "vw/core/accumulate.h"
 #include "vw/core/array_parameters.h"
+#include "vw/core/hash_cache.h"
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
@@ -133,6 +135,15 @@ void workspace::predict(multi_ex& ec)
   VW::LEARNER::require_multiline(l)->predict(ec);
 }
 
+void workspace::predict_batch(multi_ex& examples)
+{
+  if (l->is_multiline()) THROW("This learner does not support single-line examples.");
+
+  for (auto& ex : examples) { ex->test_only = true; }
+
+  VW::LEARNER::require_singleline(l)->predict_batch(examples);
+}
+
 void workspace::finish_example(example& ec)
 {
   if (l->is_multiline()) THROW("This learner does not support single-line examples.");
@@ -410,6 +421,14 @@ void workspace::finish()
   {
     sd->print_summary(*output_runtime.trace_message, *sd, *loss_config.loss, passes_config.current_pass,
         passes_config.holdout_set_off);
+
+    if (parser_runtime.example_parser->feature_hash_cache != nullptr)
+    {
+      const auto stats = parser_runtime.example_parser->feature_hash_cache->get_stats();
+      const auto lookups = stats.hits + stats.misses;
+      *output_runtime.trace_message << "hash cache hit rate = "
+                                    << (lookups > 0 ? 100.0 * stats.hits / lookups : 0.0) << "%" << std::endl;
+    }
   }
 
   details::finalize_regressor(*this, output_model_config.final_regressor_name);
@@ -0,0 +1,145 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/hash_cache.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/common/vw_throw.h"
+#include "vw/core/memory.h"
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace
+{
+// Together with the other fields of an entry this fills a cache line.
+constexpr size_t MAX_KEY_LENGTH = 52;
+constexpr uint32_t EMPTY_ENTRY = std::numeric_limits<uint32_t>::max();
+
+std::atomic<uint64_t> next_cache_id{1};
+
+// Picks the entry of a string from its length and its first and last 8 bytes, which is much cheaper than hashing all
+// of it. Strings which collide only cost a miss.
+uint64_t slot(const char* s, size_t len, uint32_t seed)
+{
+  uint64_t head = 0;
+  uint64_t tail = 0;
+  if (len >= sizeof(uint64_t))
+  {
+    std::memcpy(&head, s, sizeof(uint64_t));
+    std::memcpy(&tail, s + len - sizeof(uint64_t), sizeof(uint64_t));
+  }
+  else { std::memcpy(&head, s, len); }
+
+  uint64_t x = head ^ (tail * 0x9e3779b97f4a7c15) ^ ((static_cast<uint64_t>(seed) << 32) | len);
+  x ^= x >> 31;
+  x *= 0xbf58476d1ce4e5b9;
+  x ^= x >> 29;
+  return x;
+}
+}  // namespace
+
+class VW::details::hash_cache::table
+{
+public:
+  explicit table(size_t num_entries) : _entries(num_entries) {}
+
+  uint32_t hash(VW::hash_func_t hasher, const char* s, size_t len, uint32_t seed)
+  {
+    if (len == 0 || len > MAX_KEY_LENGTH)
+    {
+      count(misses);
+      return hasher(s, len, seed);
+    }
+
+    auto& e = _entries[slot(s, len, seed) & (_entries.size() - 1)];
+    if (e.length == len && e.seed == seed && std::memcmp(e.key, s, len) == 0)
+    {
+      count(hits);
+      return e.hash;
+    }
+
+    count(misses);
+    e.hash = hasher(s, len, seed);
+    e.seed = seed;
+    e.length = static_cast<uint32_t>(len);
+    std::memcpy(e.key, s, len);
+    return e.hash;
+  }
+
+  // Only written by the thread which owns the table, and read by get_stats.
+  std::atomic<uint64_t> hits{0};
+  std::atomic<uint64_t> misses{0};
+
+private:
+  class entry
+  {
+  public:
+    uint32_t seed = 0;
+    uint32_t hash = 0;
+    uint32_t length = EMPTY_ENTRY;
+    char key[MAX_KEY_LENGTH];
+  };
+
+  static void count(std::atomic<uint64_t>& counter)
+  {
+    // There is a single writer, so this does not need an atomic increment.
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  std::vector<entry> _entries;
+};
+
+VW::details::hash_cache::hash_cache(hash_func_t hasher, size_t num_entries)
+    : _hasher(hasher), _num_entries(1), _id(next_cache_id.fetch_add(1, std::memory_order_relaxed))
+{
+  if (hasher != VW::details::hashstring && hasher != VW::details::hashall)
+  {
+    THROW("Only the hash functions returned by get_hasher can be cached");
+  }
+  while (_num_entries < num_entries) { _num_entries <<= 1; }
+}
+
+VW::details::hash_cache::~hash_cache() = default;
+
+uint32_t VW::details::hash_cache::hash(const char* s, size_t len, uint32_t seed)
+{
+  return get_table().hash(_hasher, s, len, seed);
+}
+
+VW::details::hash_cache::table& VW::details::hash_cache::get_table()
+{
+  // The table which the calling thread used last. A thread usually hashes through only one cache.
+  static thread_local uint64_t last_id = 0;
+  static thread_local table* last_table = nullptr;
+  if (last_id == _id) { return *last_table; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& t = _tables[std::this_thread::get_id()];
+  if (t == nullptr) { t = VW::make_unique<table>(_num_entries); }
+  last_id = _id;
+  last_table = t.get();
+  return *t;
+}
+
+VW::hash_cache_stats VW::details::hash_cache::get_stats() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  VW::hash_cache_stats stats;
+  for (const auto& t : _tables)
+  {
+    stats.hits += t.second->hits.load(std::memory_order_relaxed);
+    stats.misses += t.second->misses.load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+VW::feature_hasher::feature_hasher(details::hash_cache& cache) : _hasher(cache.get_hasher()), _cache(&cache) {}
+
+uint32_t VW::feature_hasher::cached_hash(const char* s, size_t len, uint32_t seed) const
+{
+  return _cache->hash(s, len, seed);
+}
@@ -3,8 +3,21 @@
 // license as described in the file LICENSE.
 #include "vw/core/io_buf.h"
 
+#include <cstring>
+
 size_t VW::io_buf::buf_read(char*& pointer, size_t n)
 {
+  if (_view_head != nullptr)
+  {
+    if (_view_head + n <= _view_end)
+    {
+      pointer = _view_head;
+      _view_head += n;
+      return n;
+    }
+    end_view();
+  }
+
   // return a pointer to the next n bytes.  n must be smaller than the maximum size.
   if (_head + n <= _buffer.end)
   {
@@ -20,6 +33,7 @@ size_t VW::io_buf::buf_read(char*& pointer, size_t n)
       _buffer.shift_to_front(_head);
       _head = _buffer.begin;
     }
+    if (_current < _input_files.size() && start_view()) { return buf_read(pointer, n); }
     if (_current < _input_files.size() && fill(_input_files[_current].get()) > 0)
     {                               // read more bytes from _current file if present
       return buf_read(pointer, n);  // more bytes are read.
@@ -40,11 +54,19 @@ size_t VW::io_buf::buf_read(char*& pointer, size_t n)
 
 bool VW::io_buf::isbinary()
 {
-  if (_buffer.end == _head)
+  if (_buffer.end == _head && _view_head == nullptr && !start_view())
   {
     if (fill(_input_files[_current].get()) <= 0) { return false; }
   }
 
+  if (_view_head != nullptr)
+  {
+    if (_view_head == _view_end) { return false; }
+    bool ret = (*_view_head == 0);
+    if (ret) { _view_head++; }
+    return ret;
+  }
+
   bool ret = (*_head == 0);
   if (ret) { _head++; }
 
@@ -53,6 +75,18 @@ bool VW::io_buf::isbinary()
 
 size_t VW::io_buf::readto(char*& pointer, char terminal)
 {
+  if (_view_head != nullptr)
+  {
+    auto* found = static_cast<char*>(std::memchr(_view_head, terminal, _view_end - _view_head));
+    if (found != nullptr)
+    {
+      pointer = _view_head;
+      _view_head = found + 1;
+      return _view_head - pointer;
+    }
+    end_view();
+  }
+
   // Return a pointer to the bytes before the terminal.  Must be less than the buffer size.
   pointer = _head;
   while (pointer < _buffer.end && *pointer != terminal) { pointer++; }
@@ -72,6 +106,7 @@ size_t VW::io_buf::readto(char*& pointer, char terminal)
       _head = _buffer.begin;
     }
 
+    if (_current < _input_files.size() && start_view()) { return readto(pointer, terminal); }
     if (_current < _input_files.size() && fill(_input_files[_current].get()) > 0)
     {  // more bytes are read.
       return readto(pointer, terminal);
@@ -149,6 +184,34 @@ void VW::io_buf::reset()
   _buffer.end = _buffer.begin;
   _head = _buffer.begin;
   _current = 0;
+  _view_head = nullptr;
+  _view_end = nullptr;
+}
+
+bool VW::io_buf::start_view()
+{
+  if (_head != _buffer.end) { return false; }
+  char* data = nullptr;
+  size_t num_bytes = 0;
+  if (!_input_files[_current]->read_view(data, num_bytes) || num_bytes == 0) { return false; }
+  _view_head = data;
+  _view_end = data + num_bytes;
+  return true;
+}
+
+void VW::io_buf::end_view()
+{
+  if (_view_head == nullptr) { return; }
+  const size_t remaining = _view_end - _view_head;
+  _buffer.shift_to_front(_head);
+  _head = _buffer.begin;
+  size_t capacity = _buffer.capacity();
+  while (capacity - _buffer.size() <= remaining) { capacity *= 2; }
+  if (capacity != _buffer.capacity()) { _buffer.realloc(capacity); }
+  std::memcpy(_buffer.end, _view_head, remaining);
+  _buffer.end += remaining;
+  _view_head = nullptr;
+  _view_end = nullptr;
 }
 
 bool VW::io_buf::is_resettable() const
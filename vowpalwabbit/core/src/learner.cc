@@ -423,6 +423,24 @@ void learner::multipredict(polymorphic_ex ec, size_t lo, size_t count, polypredi
   }
 }
 
+void learner::predict_batch(multi_ex& examples, size_t i)
+{
+  assert(!is_multiline());
+  if (_predict_batch_f == nullptr)
+  {
+    for (auto* ex : examples) { predict(*ex, i); }
+    return;
+  }
+
+  for (auto* ex : examples)
+  {
+    details::increment_offset(*ex, feature_width_below, i);
+    debug_log_message(*ex, "predict_batch");
+  }
+  _predict_batch_f(examples);
+  for (auto* ex : examples) { details::decrement_offset(*ex, feature_width_below, i); }
+}
+
 void learner::update(polymorphic_ex ec, size_t i)
 {
   assert(is_multiline() == ec.is_multiline());
@@ -666,6 +684,7 @@ std::shared_ptr<learner> learner::create_learner_above_this()
 
   // Don't propagate these functions
   l->_multipredict_f = nullptr;
+  l->_predict_batch_f = nullptr;
   l->_save_load_f = nullptr;
   l->_pre_save_load_f = nullptr;
   l->_end_pass_f = nullptr;
@@ -0,0 +1,221 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/learner_replicas.h"
+
+#include "vw/common/future_compat.h"
+#include "vw/common/vw_exception.h"
+#include "vw/common/vw_throw.h"
+#include "vw/config/cli_options_serializer.h"
+#include "vw/config/options.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/example.h"
+#include "vw/core/global_data.h"
+#include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/parse_primitives.h"
+#include "vw/core/shared_data.h"
+#include "vw/core/shared_score_reduction_features.h"
+#include "vw/core/vw.h"
+
+#include <cassert>
+#include <exception>
+#include <future>
+#include <set>
+
+namespace
+{
+// Option groups which configure input, output and logging rather than learning.
+const std::set<std::string> EXCLUDED_OPTION_GROUPS = {
+    "Diagnostic", "Input", "Prediction Output", "Output Model", "Logging", "Parser", "Parallelization"};
+
+std::vector<std::string> replica_args(VW::config::options_i& options, const std::vector<std::string>& excluded_options)
+{
+  VW::config::cli_options_serializer serializer;
+  std::set<std::string> added(excluded_options.begin(), excluded_options.end());
+  // The replicas share the weights of the original, so they do not load them again.
+  added.insert("initial_regressor");
+  for (const auto& group : options.get_all_option_group_definitions())
+  {
+    if (EXCLUDED_OPTION_GROUPS.count(group.m_name) > 0) { continue; }
+    for (const auto& option : group.m_options)
+    {
+      if (options.was_supplied(option->m_name) && added.insert(option->m_name).second) { serializer.add(*option); }
+    }
+  }
+  auto args = VW::split_command_line(serializer.str());
+  args.emplace_back("--quiet");
+  return args;
+}
+
+void copy_example(VW::example& dst, const VW::example& src)
+{
+  // Namespaces which are not in indices are not copied, but interactions would still see them.
+  for (auto ns : dst.indices) { dst.feature_space[ns].clear(); }
+  delete dst.passthrough;
+  dst.passthrough = nullptr;
+  VW::copy_example_data_with_label(&dst, &src);
+  dst.ex_reduction_features = src.ex_reduction_features;
+}
+}  // namespace
+
+class VW::details::learner_replicas::replica
+{
+public:
+  std::unique_ptr<VW::workspace> all;
+  VW::LEARNER::learner* base = nullptr;
+  std::vector<std::unique_ptr<VW::example>> owned_examples;
+  VW::multi_ex examples;
+  // gd writes to the shared score of --cache_shared_score and swaps namespaces with its shared example while it
+  // predicts, so every replica has its own copy of both.
+  VW::example shared_example;
+  VW::shared_feature_merger::shared_score shared_score;
+
+  void copy_examples(const VW::workspace& original, const VW::multi_ex& src)
+  {
+    while (owned_examples.size() < src.size()) { owned_examples.push_back(VW::make_unique<VW::example>()); }
+    examples.clear();
+    const VW::shared_feature_merger::shared_score* copied_shared_score = nullptr;
+    for (size_t i = 0; i < src.size(); i++)
+    {
+      copy_example(*owned_examples[i], *src[i]);
+      auto& shared =
+          owned_examples[i]->ex_reduction_features.get<VW::shared_feature_merger::reduction_features>().shared;
+      if (shared != nullptr)
+      {
+        if (shared != copied_shared_score)
+        {
+          copy_shared_score(*shared);
+          copied_shared_score = shared;
+        }
+        shared = &shared_score;
+      }
+      examples.push_back(owned_examples[i].get());
+    }
+    *all->sd = *original.sd;
+    all->update_rule_config.eta = original.update_rule_config.eta;
+  }
+
+  void copy_shared_score(const VW::shared_feature_merger::shared_score& src)
+  {
+    for (auto ns : shared_score.namespaces) { shared_example.feature_space[ns].clear(); }
+    shared_score.reset(&shared_example);
+    for (auto ns : src.namespaces)
+    {
+      shared_score.namespaces.push_back(ns);
+      shared_example.feature_space[ns] = src.shared_example->feature_space[ns];
+    }
+  }
+};
+
+VW::details::learner_replicas::learner_replicas(VW::workspace& all, const std::string& reduction_name,
+    size_t num_replicas, const std::vector<std::string>& excluded_options)
+    : _all(all), _pool(num_replicas)
+{
+  check_supported(all);
+
+  const auto args = replica_args(*all.options, excluded_options);
+  for (size_t i = 0; i < num_replicas; i++)
+  {
+    auto r = VW::make_unique<replica>();
+    // Without a model to load the replica does not allocate weights, so it only ever has those of the original.
+    std::unique_ptr<VW::config::options_i, VW::options_deleter_type> options(
+        new VW::config::options_cli(args), [](VW::config::options_i* ptr) { delete ptr; });
+    VW_WARNING_STATE_PUSH
+    VW_WARNING_DISABLE_DEPRECATED_USAGE
+    r->all.reset(VW::initialize(std::move(options), nullptr, true /* skip_model_load */));
+    VW_WARNING_STATE_POP
+    assert(!r->all->weights.dense_weights.not_null());
+    r->all->weights.shallow_copy(all.weights);
+    auto* reduction = r->all->l->get_learner_by_name_prefix(reduction_name);
+    if (reduction == nullptr || reduction->get_base_learner() == nullptr)
+    {
+      THROW("Could not find the base of " << reduction_name << " in a replica");
+    }
+    r->base = reduction->get_base_learner();
+    _replicas.push_back(std::move(r));
+  }
+}
+
+VW::details::learner_replicas::~learner_replicas() = default;
+
+void VW::details::learner_replicas::check_supported(const VW::workspace& all)
+{
+  // Regularization rescales all of the weights from within learn.
+  if (all.loss_config.l1_lambda > 0.f || all.loss_config.l2_lambda > 0.f)
+  {
+    THROW("--l1 and --l2 cannot be used when learning on several threads");
+  }
+  // Sparse weights allocate on access, which is not thread safe.
+  if (all.weights.sparse) { THROW("--sparse_weights cannot be used when learning on several threads"); }
+}
+
+void VW::details::learner_replicas::share_weights()
+{
+  // The weights of the original are replaced, rather than updated, when for example the daemon reloads its model.
+  for (auto& r : _replicas)
+  {
+    if (r->all->weights.dense_weights.data() != _all.weights.dense_weights.data())
+    {
+      r->all->weights.shallow_copy(_all.weights);
+    }
+  }
+}
+
+void VW::details::learner_replicas::for_each_model(
+    size_t num_models, VW::LEARNER::learner& base, VW::multi_ex& examples, const multi_model_func& fn)
+{
+  if (num_models == 0) { return; }
+  share_weights();
+  const size_t num_workers = _replicas.size() + 1;
+  // The copies are made before any worker starts, while the original examples and shared data are unchanged.
+  for (size_t i = 0; i < _replicas.size() && i + 1 < num_models; i++) { _replicas[i]->copy_examples(_all, examples); }
+
+  std::vector<std::future<void>> results;
+  for (size_t i = 0; i < _replicas.size() && i + 1 < num_models; i++)
+  {
+    results.push_back(_pool.submit(
+        [this, i, num_models, num_workers, &fn]()
+        {
+          auto& r = *_replicas[i];
+          for (size_t k = (num_models - 2 - i) / num_workers + 1; k > 0; k--)
+          {
+            fn(i + 1 + (k - 1) * num_workers, *r.base, r.examples);
+          }
+        }));
+  }
+
+  std::exception_ptr error;
+  try
+  {
+    for (size_t k = (num_models - 1) / num_workers + 1; k > 0; k--) { fn((k - 1) * num_workers, base, examples); }
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  // Every replica has to finish before the examples they were copied from change again.
+  for (auto& result : results)
+  {
+    try
+    {
+      result.get();
+    }
+    catch (...)
+    {
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+}
+
+void VW::details::learner_replicas::for_each_model(
+    size_t num_models, VW::LEARNER::learner& base, VW::example& ec, const single_model_func& fn)
+{
+  VW::multi_ex examples = {&ec};
+  for_each_model(num_models, base, examples,
+      [&fn](size_t model, VW::LEARNER::learner& model_base, VW::multi_ex& model_examples)
+      { fn(model, model_base, *model_examples[0]); });
+}
@@ -13,10 +13,12 @@
 #include "vw/config/options.h"
 #include "vw/config/options_cli.h"
 #include "vw/core/accumulate.h"
+#include "vw/core/async_writer.h"
 #include "vw/core/best_constant.h"
 #include "vw/core/constant.h"
 #include "vw/core/crossplat_compat.h"
 #include "vw/core/global_data.h"
+#include "vw/core/hash_cache.h"
 #include "vw/core/interactions.h"
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/label_parser.h"
@@ -50,6 +52,7 @@
 #include <algorithm>
 #include <array>
 #include <cfloat>
+#include <chrono>
 #include <cstdio>
 #include <fstream>
 #include <sstream>
@@ -387,11 +390,27 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
       .add(make_option("num_children", parsed_options.num_children)
                .default_value(10)
                .help("Number of children for persistent daemon mode"))
+      .add(make_option("daemon_threads", parsed_options.daemon_threads)
+               .default_value(0)
+               .help("Serve persistent daemon mode clients from this many threads of a single process instead of "
+                     "forking children. Linux only"))
       .add(make_option("pid_file", parsed_options.pid_file).help("Write pid file in persistent daemon mode"))
       .add(make_option("port_file", parsed_options.port_file).help("Write port used in persistent daemon mode"))
 #endif
       .add(make_option("cache", parsed_options.cache).short_name("c").help("Use a cache.  The default is <data>.cache"))
       .add(make_option("cache_file", parsed_options.cache_files).help("The location(s) of cache_file"))
+      .add(make_option("cache_format", parsed_options.cache_format)
+               .default_value("v1")
+               .one_of({"v1", "v2"})
+               .help("Format of cache files which are created. v2 stores compressed and checksummed blocks of "
+                     "examples with an index, blocks are decoded on --parse_threads threads"))
+      .add(make_option("shuffle_blocks", parsed_options.shuffle_blocks)
+               .help("Visit the blocks of a --cache_format v2 cache in a different random order, drawn from "
+                     "--random_seed, on every pass which reads the cache. Disables the holdout set"))
+      .add(make_option("shuffle_window", parsed_options.shuffle_window)
+               .default_value(VW::parsers::cache::DEFAULT_SHUFFLE_WINDOW_BLOCKS)
+               .help("Number of cache blocks whose examples are permuted together by --shuffle_blocks. Bounds the "
+                     "memory used for shuffling"))
       .add(make_option("json", parsed_options.json).help("Enable JSON parsing"))
       .add(make_option("dsjson", parsed_options.dsjson).help("Enable Decision Service JSON parsing"))
       .add(make_option("kill_cache", parsed_options.kill_cache)
@@ -402,7 +421,14 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
               .help(
                   "use gzip format whenever possible. If a cache file is being created, this option creates a "
                   "compressed cache file. A mixture of raw-text & compressed inputs are supported with autodetection."))
+      .add(make_option("decompress_threads", parsed_options.decompress_threads)
+               .default_value(0)
+               .help("Decompress gzip data files on this many background threads ahead of the parser. The blocks of "
+                     "BGZF files are decompressed in parallel. 0 decompresses on the parser thread"))
       .add(make_option("no_stdin", parsed_options.stdin_off).help("Do not default to reading from stdin"))
+      .add(make_option("mmap_input", parsed_options.mmap_input)
+               .help("Map uncompressed data and cache files into memory and parse them in place instead of copying "
+                     "them into a read buffer. Not supported on Windows"))
 #ifdef VW_FEAT_NETWORKING_ENABLED
       .add(make_option("no_daemon", parsed_options.no_daemon)
                .help("Force a loaded daemon or active learning model to accept local input instead of starting in "
@@ -441,8 +467,9 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
   }
 
 #ifdef VW_FEAT_NETWORKING_ENABLED
-  if (parsed_options.daemon || options.was_supplied("pid_file") ||
-      (options.was_supplied("port") && !all.reduction_state.active))
+  if (!parsed_options.no_daemon &&
+      (parsed_options.daemon || options.was_supplied("pid_file") ||
+          (options.was_supplied("port") && !all.reduction_state.active)))
   {
     all.runtime_config.daemon = true;
     // allow each child to process up to 1e5 connections
@@ -456,6 +483,13 @@ VW::details::input_options parse_source(VW::workspace& all, options_i& options)
   if ((parsed_options.cache || options.was_supplied("cache_file")) && options.was_supplied("invert_hash"))
     THROW("invert_hash is incompatible with a cache file.  Use it in single pass mode only.")
 
+  if (parsed_options.shuffle_blocks && !all.passes_config.holdout_set_off)
+  {
+    // The holdout set is every holdout_period-th example, which would be a different set of examples on every pass.
+    all.passes_config.holdout_set_off = true;
+    *(all.output_runtime.trace_message) << "Making holdout_set_off=true since --shuffle_blocks specified" << endl;
+  }
+
   if (!all.passes_config.holdout_set_off &&
       (options.was_supplied("output_feature_regularizer_binary") ||
           options.was_supplied("output_feature_regularizer_text")))
@@ -536,6 +570,7 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
     std::vector<std::string>& dictionary_nses)
 {
   std::string hash_function;
+  uint64_t hash_cache_size = 0;
   uint32_t new_bits;
   std::vector<std::string> spelling_ns;
   std::vector<std::string> quadratics;
@@ -567,6 +602,10 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
                .help("How to hash the features"))
       .add(
           make_option("hash_seed", all.runtime_config.hash_seed).keep().default_value(0).help("Seed for hash function"))
+      .add(make_option("hash_cache_size", hash_cache_size)
+               .default_value(0)
+               .help("Cache the hashes of this many recently seen feature and namespace names in each parsing "
+                     "thread. 0 turns the cache off"))
       .add(make_option("ignore", ignores).keep().help("Ignore namespaces beginning with character <arg>"))
       .add(make_option("ignore_linear", ignore_linears)
                .keep()
@@ -629,7 +668,14 @@ void parse_feature_tweaks(options_i& options, VW::workspace& all, bool interacti
   options.add_and_parse(feature_options);
 
   // feature manipulation
-  all.parser_runtime.example_parser->hasher = VW::get_hasher(hash_function);
+  auto& example_parser = *all.parser_runtime.example_parser;
+  example_parser.hasher = VW::get_hasher(hash_function);
+  if (hash_cache_size > 0)
+  {
+    example_parser.feature_hash_cache = VW::make_unique<VW::details::hash_cache>(
+        example_parser.hasher.get_hash_function(), VW::cast_to_smaller_type<size_t>(hash_cache_size));
+    example_parser.hasher = VW::feature_hasher(*example_parser.feature_hash_cache);
+  }
 
   if (options.was_supplied("spelling"))
   {
@@ -1234,31 +1280,57 @@ void parse_update_options(options_i& options, VW::workspace& all)
   all.update_rule_config.initial_t = static_cast<float>(all.sd->t);
 }
 
+// Number of full prediction buffers which may wait for the background writer before output blocks the learner.
+constexpr size_t ASYNC_PREDICTION_PENDING_BUFFERS = 16;
+
 void parse_output_preds(options_i& options, VW::workspace& all)
 {
   std::string predictions;
   std::string raw_predictions;
+  bool async_predictions = false;
+  uint64_t prediction_buffer_size = 65536;
+  uint64_t prediction_flush_interval = 0;
 
   option_group_definition output_options("Prediction Output");
   output_options.add(make_option("predictions", predictions).short_name("p").help("File to output predictions to"))
       .add(make_option("raw_predictions", raw_predictions)
                .short_name("r")
-               .help("File to output unnormalized predictions to"));
+               .help("File to output unnormalized predictions to"))
+      .add(make_option("async_predictions", async_predictions)
+               .help("Write predictions and raw predictions from a background thread, so that learning does not wait "
+                     "for the output"))
+      .add(make_option("prediction_buffer_size", prediction_buffer_size)
+               .default_value(65536)
+               .help("Number of bytes of output to collect before it is written, with --async_predictions"))
+      .add(make_option("prediction_flush_interval", prediction_flush_interval)
+               .default_value(0)
+               .help("With --async_predictions, also write out collected output when a prediction is written at "
+                     "least this many milliseconds after the last write. 0 only writes full buffers"));
   options.add_and_parse(output_options);
 
+  if (async_predictions && prediction_buffer_size == 0) { THROW("--prediction_buffer_size must be positive"); }
+  auto make_prediction_writer = [&](std::unique_ptr<VW::io::writer> writer) -> std::unique_ptr<VW::io::writer>
+  {
+    if (!async_predictions) { return writer; }
+    return VW::make_unique<VW::details::async_writer>(std::move(writer),
+        VW::cast_to_smaller_type<size_t>(prediction_buffer_size), ASYNC_PREDICTION_PENDING_BUFFERS,
+        std::chrono::milliseconds(prediction_flush_interval));
+  };
+
   if (options.was_supplied("predictions"))
   {
     if (!all.output_config.quiet) { *(all.output_runtime.trace_message) << "predictions = " << predictions << endl; }
 
     if (predictions == "stdout")
     {
-      all.output_runtime.final_prediction_sink.push_back(VW::io::open_stdout());  // stdout
+      all.output_runtime.final_prediction_sink.push_back(make_prediction_writer(VW::io::open_stdout()));  // stdout
     }
     else
     {
       try
       {
-        all.output_runtime.final_prediction_sink.push_back(VW::io::open_file_writer(predictions));
+        all.output_runtime.final_prediction_sink.push_back(
+            make_prediction_writer(VW::io::open_file_writer(predictions)));
       }
       catch (...)
       {
@@ -1277,8 +1349,11 @@ void parse_output_preds(options_i& options, VW::workspace& all)
         all.logger.err_warn("--raw_predictions has no defined value when --binary specified, expect no output");
       }
     }
-    if (raw_predictions == "stdout") { all.output_runtime.raw_prediction = VW::io::open_stdout(); }
-    else { all.output_runtime.raw_prediction = VW::io::open_file_writer(raw_predictions); }
+    if (raw_predictions == "stdout")
+    {
+      all.output_runtime.raw_prediction = make_prediction_writer(VW::io::open_stdout());
+    }
+    else { all.output_runtime.raw_prediction = make_prediction_writer(VW::io::open_file_writer(raw_predictions)); }
   }
 }
 
@@ -1320,6 +1395,9 @@ void parse_output_model(options_i& options, VW::workspace& all)
                      "writing a model."))
       .add(make_option("save_per_pass", all.output_model_config.save_per_pass)
                .help("Save the model after every pass over data"))
+      .add(make_option("mmap_model", all.output_model_config.mmap_model)
+               .help("Save binary models in a page aligned format whose weights are memory-mapped instead of read when "
+                     "the model is loaded with -i. Only supported for dense weights"))
       .add(make_option("output_feature_regularizer_binary", all.output_model_config.per_feature_regularizer_output)
                .help("Per feature regularization output file"))
       .add(make_option("output_feature_regularizer_text", all.output_model_config.per_feature_regularizer_text)
@@ -1354,16 +1432,31 @@ void parse_output_model(options_i& options, VW::workspace& all)
   }
 }
 
+void load_initial_regressor(VW::workspace& all, VW::io_buf& io_temp)
+{
+  // Weights of a memory-mappable model are not part of the model stream.
+  all.runtime_state.model_weights_external = !all.initial_weights_config.mapped_weights_file.empty();
+  auto reset_weights_external = VW::scope_exit([&all]() { all.runtime_state.model_weights_external = false; });
+  all.l->save_load(io_temp, true, false);
+  io_temp.close_file();
+}
+
 void load_input_model(VW::workspace& all, VW::io_buf& io_temp)
 {
+  const bool mapped = !all.initial_weights_config.mapped_weights_file.empty();
+  if (mapped && !all.feature_mask.empty()) { THROW("--feature_mask is not supported with memory-mapped models"); }
+  if (all.initial_weights_config.mapped_weights_read_only && all.runtime_config.training)
+  {
+    THROW("--mmap_read_only requires --testonly");
+  }
+
   // Need to see if we have to load feature mask first or second.
   // -i and -mask are from same file, load -i file first so mask can use it
   if (!all.feature_mask.empty() && !all.initial_weights_config.initial_regressors.empty() &&
       all.feature_mask == all.initial_weights_config.initial_regressors[0])
   {
     // load rest of regressor
-    all.l->save_load(io_temp, true, false);
-    io_temp.close_file();
+    load_initial_regressor(all, io_temp);
 
     VW::details::parse_mask_regressor_args(all, all.feature_mask, all.initial_weights_config.initial_regressors);
   }
@@ -1372,8 +1465,7 @@ void load_input_model(VW::workspace& all, VW::io_buf& io_temp)
     VW::details::parse_mask_regressor_args(all, all.feature_mask, all.initial_weights_config.initial_regressors);
 
     // load rest of regressor
-    all.l->save_load(io_temp, true, false);
-    io_temp.close_file();
+    load_initial_regressor(all, io_temp);
   }
 }
 
@@ -1486,17 +1578,23 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
   bool strict_parse = false;
   int ring_size_tmp;
   int64_t example_queue_limit_tmp;
+  uint64_t parse_threads;
   option_group_definition vw_args("Parser");
   vw_args.add(make_option("ring_size", ring_size_tmp).default_value(256).help("Size of example ring"))
       .add(make_option("example_queue_limit", example_queue_limit_tmp)
                .default_value(256)
                .help("Max number of examples to store after parsing but before the learner has processed. Rarely "
-                     "needs to be changed."))
-      .add(make_option("strict_parse", strict_parse).help("Throw on malformed examples"));
+                     "needs to be changed. The queue holds at least 2 examples, so 1 is raised to 2"))
+      .add(make_option("strict_parse", strict_parse).help("Throw on malformed examples"))
+      .add(make_option("parse_threads", parse_threads)
+               .default_value(1)
+               .help("Number of threads used to parse text input or to decode blocks of a --cache_format v2 "
+                     "cache. Examples are still learned in input order"));
   all->options->add_and_parse(vw_args);
 
   if (ring_size_tmp <= 0) { THROW("ring_size should be positive") }
   if (example_queue_limit_tmp <= 0) { THROW("ring_size should be positive") }
+  if (parse_threads == 0) { THROW("parse_threads should be positive") }
   auto ring_size = static_cast<size_t>(ring_size_tmp);
   auto example_queue_limit = static_cast<size_t>(example_queue_limit_tmp);
   auto final_example_queue_limit = example_queue_limit;
@@ -1511,8 +1609,17 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
     }
   }
 
+  if (final_example_queue_limit < 2)
+  {
+    all->logger.err_warn("The example queue holds at least 2 examples, using an example queue limit of 2");
+    final_example_queue_limit = 2;
+  }
+
   all->parser_runtime.example_parser = VW::make_unique<VW::parser>(final_example_queue_limit, strict_parse);
+  all->parser_runtime.example_parser->parse_threads = VW::cast_to_smaller_type<size_t>(parse_threads);
 
+  std::string weights_huge_pages;
+  std::string weights_numa;
   option_group_definition weight_args("Weight");
   weight_args
       .add(make_option("initial_regressor", all->initial_weights_config.initial_regressors)
@@ -1529,8 +1636,25 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
                .help("Make initial weights truncated normal"))
       .add(make_option("sparse_weights", all->weights.sparse).help("Use a sparse datastructure for weights"))
       .add(make_option("input_feature_regularizer", all->initial_weights_config.per_feature_regularizer_input)
-               .help("Per feature regularization input file"));
+               .help("Per feature regularization input file"))
+      .add(make_option("mmap_read_only", all->initial_weights_config.mapped_weights_read_only)
+               .help("Map the weights of a model saved with --mmap_model read-only instead of copy-on-write. Requires "
+                     "--testonly and a model without l1 state"))
+      .add(make_option("weights_huge_pages", weights_huge_pages)
+               .default_value("none")
+               .one_of({"none", "transparent", "2mb", "1gb"})
+               .help("Back dense weights with huge pages to reduce TLB misses on large weight tables. transparent "
+                     "asks for transparent huge pages, 2mb and 1gb use pages reserved through hugetlbfs. Linux only"))
+      .add(make_option("weights_numa", weights_numa)
+               .default_value("default")
+               .one_of({"default", "interleave", "local"})
+               .help("NUMA placement of dense weights. interleave spreads pages over all nodes, local keeps them on the "
+                     "node of the thread that first touches them. Linux only"))
+      .add(make_option("weights_prefault", all->initial_weights_config.dense_allocation.prefault)
+               .help("Touch every page of dense weights when allocating them instead of on first use"));
   all->options->add_and_parse(weight_args);
+  all->initial_weights_config.dense_allocation.pages = VW::huge_pages_from_string(weights_huge_pages);
+  all->initial_weights_config.dense_allocation.numa = VW::numa_policy_from_string(weights_numa);
 
   std::string span_server_arg;
   int32_t span_server_port_arg;
@@ -1538,6 +1662,8 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
   uint64_t unique_id_arg;
   uint64_t total_arg;
   uint64_t node_arg;
+  std::string all_reduce_algorithm;
+  std::string all_reduce_compression;
   option_group_definition parallelization_args("Parallelization");
   parallelization_args
       .add(make_option("span_server", span_server_arg).help("Location of server for setting up spanning tree"))
@@ -1547,7 +1673,18 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
       .add(make_option("node", node_arg).default_value(0).help("Node number in cluster parallel job"))
       .add(make_option("span_server_port", span_server_port_arg)
                .default_value(26543)
-               .help("Port of the server for setting up spanning tree"));
+               .help("Port of the server for setting up spanning tree"))
+      .add(make_option("all_reduce_algorithm", all_reduce_algorithm)
+               .default_value("tree")
+               .one_of({"tree", "ring"})
+               .help("Algorithm used to combine state across nodes when using --span_server. The ring moves less "
+                     "data through each node and scales better with the number of nodes for large weight vectors"))
+      .add(make_option("all_reduce_compression", all_reduce_compression)
+               .default_value("none")
+               .one_of({"none", "sparse", "fp16", "int8"})
+               .help("Compression of the weights exchanged when averaging across nodes. Only blocks of weights that "
+                     "changed since the last sync are sent. sparse sends them exactly, fp16 and int8 quantize them and "
+                     "carry the quantization error over to the next sync"));
   all->options->add_and_parse(parallelization_args);
 
   // total, unique_id and node must be specified together.
@@ -1561,11 +1698,28 @@ std::unique_ptr<VW::workspace> VW::details::parse_args(std::unique_ptr<options_i
 
   if (all->options->was_supplied("span_server"))
   {
-    all->runtime_config.selected_all_reduce_type = VW::all_reduce_type::SOCKET;
-    all->runtime_state.all_reduce.reset(
-        new VW::all_reduce_sockets(span_server_arg, VW::cast_to_smaller_type<int>(span_server_port_arg),
-            VW::cast_to_smaller_type<size_t>(unique_id_arg), VW::cast_to_smaller_type<size_t>(total_arg),
-            VW::cast_to_smaller_type<size_t>(node_arg), all->output_config.quiet));
+    if (all_reduce_algorithm == "ring")
+    {
+      all->runtime_config.selected_all_reduce_type = VW::all_reduce_type::SOCKET_RING;
+      all->runtime_state.all_reduce.reset(
+          new VW::all_reduce_ring_sockets(span_server_arg, VW::cast_to_smaller_type<int>(span_server_port_arg),
+              VW::cast_to_smaller_type<size_t>(unique_id_arg), VW::cast_to_smaller_type<size_t>(total_arg),
+              VW::cast_to_smaller_type<size_t>(node_arg), all->output_config.quiet));
+    }
+    else
+    {
+      all->runtime_config.selected_all_reduce_type = VW::all_reduce_type::SOCKET;
+      all->runtime_state.all_reduce.reset(
+          new VW::all_reduce_sockets(span_server_arg, VW::cast_to_smaller_type<int>(span_server_port_arg),
+              VW::cast_to_smaller_type<size_t>(unique_id_arg), VW::cast_to_smaller_type<size_t>(total_arg),
+              VW::cast_to_smaller_type<size_t>(node_arg), all->output_config.quiet));
+    }
+  }
+
+  if (all_reduce_compression != "none")
+  {
+    all->runtime_state.all_reduce_compression = VW::make_unique<VW::details::all_reduce_compression_state>(
+        VW::details::all_reduce_compression_from_string(all_reduce_compression));
   }
 
   parse_diagnostics(*all->options, *all);
@@ -23,6 +23,8 @@
 #include "vw/core/global_data.h"
 #include "vw/core/kskip_ngram_transformer.h"
 #include "vw/core/learner.h"
+#include "vw/core/memory.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw_validate.h"
 #include "vw/core/vw_versions.h"
@@ -33,6 +35,7 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <numeric>
@@ -69,6 +72,18 @@ void truncate(VW::workspace& all, T& weights)
       });
 }
 
+void allocate_weights(VW::workspace& /* all */, VW::sparse_parameters& weights, size_t length)
+{
+  uint32_t ss = weights.stride_shift();
+  weights.~sparse_parameters();  // dealloc so that we can realloc, now with a known size
+  new (&weights) VW::sparse_parameters(length, ss);
+}
+
+void allocate_weights(VW::workspace& all, VW::dense_parameters& weights, size_t length)
+{
+  weights = VW::dense_parameters(length, weights.stride_shift(), all.initial_weights_config.dense_allocation);
+}
+
 template <class T>
 void initialize_regressor(VW::workspace& all, T& weights)
 {
@@ -78,12 +93,12 @@ void initialize_regressor(VW::workspace& all, T& weights)
   size_t length = (static_cast<size_t>(1)) << all.initial_weights_config.num_bits;
   try
   {
-    uint32_t ss = weights.stride_shift();
-    weights.~T();  // dealloc so that we can realloc, now with a known size
-    new (&weights) T(length, ss);
+    allocate_weights(all, weights, length);
   }
   catch (const VW::vw_exception&)
   {
+    // The message of a failed huge page or NUMA allocation says more than the generic one below.
+    if (!all.initial_weights_config.dense_allocation.is_default()) { throw; }
     THROW(" Failed to allocate weight array with " << all.initial_weights_config.num_bits
                                                    << " bits: try decreasing -b <bits>");
   }
@@ -121,9 +136,171 @@ void initialize_regressor(VW::workspace& all, T& weights)
   }
 }
 
+namespace
+{
+// Layout of a memory-mappable model file:
+//   mmap_model_preamble
+//   the regular binary model (header and reduction state) without the weights, model_state_size bytes
+//   zero padding up to weights_offset, which is a multiple of MMAP_MODEL_ALIGNMENT
+//   the raw dense weight array, weights_size bytes
+// The alignment is a multiple of every common page size so the weight array can be mapped directly.
+constexpr char MMAP_MODEL_MAGIC[8] = {'V', 'W', 'M', 'M', 'A', 'P', '\0', '\0'};
+constexpr uint32_t MMAP_MODEL_FORMAT_VERSION = 1;
+constexpr uint64_t MMAP_MODEL_ALIGNMENT = 1 << 16;
+constexpr size_t MMAP_MODEL_WRITE_CHUNK_SIZE = 1 << 16;
+
+class mmap_model_preamble
+{
+public:
+  char magic[8];
+  uint32_t format_version;
+  uint32_t num_bits;
+  uint32_t stride_shift;
+  uint32_t reserved;
+  uint64_t model_state_offset;
+  uint64_t model_state_size;
+  uint64_t weights_offset;
+  uint64_t weights_size;
+};
+
+// Reads at most limit bytes from the wrapped reader, so that reductions which read until the end of the model stream
+// stop before the padding and the weights.
+class limited_reader : public VW::io::reader
+{
+public:
+  limited_reader(std::unique_ptr<VW::io::reader> inner, uint64_t limit)
+      : VW::io::reader(false), _inner(std::move(inner)), _remaining(limit)
+  {
+  }
+
+  ssize_t read(char* buffer, size_t num_bytes) override
+  {
+    const auto to_read = static_cast<size_t>(std::min<uint64_t>(num_bytes, _remaining));
+    if (to_read == 0) { return 0; }
+    const auto num_read = _inner->read(buffer, to_read);
+    if (num_read > 0) { _remaining -= static_cast<uint64_t>(num_read); }
+    return num_read;
+  }
+
+private:
+  std::unique_ptr<VW::io::reader> _inner;
+  uint64_t _remaining;
+};
+
+size_t read_fully(VW::io::reader& reader, char* buffer, size_t num_bytes)
+{
+  size_t total = 0;
+  while (total < num_bytes)
+  {
+    const auto num_read = reader.read(buffer + total, num_bytes - total);
+    if (num_read <= 0) { break; }
+    total += static_cast<size_t>(num_read);
+  }
+  return total;
+}
+
+// Returns false if the reader does not start with a memory-mappable model preamble. On success the reader is
+// positioned at the start of the model state.
+bool read_mmap_model_preamble(VW::io::reader& reader, const std::string& file_name, mmap_model_preamble& preamble)
+{
+  if (read_fully(reader, reinterpret_cast<char*>(&preamble), sizeof(preamble)) != sizeof(preamble)) { return false; }
+  if (std::memcmp(preamble.magic, MMAP_MODEL_MAGIC, sizeof(MMAP_MODEL_MAGIC)) != 0) { return false; }
+
+  if (preamble.format_version != MMAP_MODEL_FORMAT_VERSION)
+  {
+    THROW("Model file " << file_name << " has memory-mappable format version " << preamble.format_version
+                        << " but only version " << MMAP_MODEL_FORMAT_VERSION << " is supported");
+  }
+  if (preamble.model_state_offset < sizeof(preamble) ||
+      preamble.weights_offset < preamble.model_state_offset + preamble.model_state_size ||
+      preamble.weights_offset % MMAP_MODEL_ALIGNMENT != 0)
+  {
+    THROW("Model file " << file_name << " has a corrupted memory-mappable preamble");
+  }
+
+  std::vector<char> skipped(static_cast<size_t>(preamble.model_state_offset - sizeof(preamble)));
+  if (read_fully(reader, skipped.data(), skipped.size()) != skipped.size())
+  {
+    THROW("Model file " << file_name << " has a corrupted memory-mappable preamble");
+  }
+  return true;
+}
+
+void map_initial_regressor(VW::workspace& all)
+{
+  auto& weights = all.weights.dense_weights;
+  if (weights.not_null()) { return; }
+
+  const auto& config = all.initial_weights_config;
+  const size_t length = static_cast<size_t>(1) << config.num_bits;
+  const uint64_t expected_size = (static_cast<uint64_t>(length) << weights.stride_shift()) * sizeof(VW::weight);
+  if (expected_size != config.mapped_weights_size)
+  {
+    THROW("Weights in " << config.mapped_weights_file << " are " << config.mapped_weights_size
+                        << " bytes but the model needs " << expected_size
+                        << " bytes. The number of bits and the reductions must match the saved model");
+  }
+
+  weights = VW::dense_parameters::map_file(config.mapped_weights_file, config.mapped_weights_offset, length,
+      weights.stride_shift(), config.mapped_weights_read_only);
+}
+
+void dump_mmap_regressor(VW::workspace& all, VW::io_buf& buf)
+{
+  if (all.weights.sparse) { THROW("--mmap_model is not supported with --sparse_weights"); }
+
+  auto model_state = std::make_shared<std::vector<char>>();
+  {
+    VW::io_buf state_buf;
+    state_buf.add_file(VW::io::create_vector_writer(model_state));
+    const bool weights_external = all.runtime_state.model_weights_external;
+    all.runtime_state.model_weights_external = true;
+    auto restore_weights_external =
+        VW::scope_exit([&all, weights_external]() { all.runtime_state.model_weights_external = weights_external; });
+    VW::details::dump_regressor(all, state_buf, false);
+  }
+
+  const auto& weights = all.weights.dense_weights;
+  mmap_model_preamble preamble;
+  std::memset(&preamble, 0, sizeof(preamble));
+  std::memcpy(preamble.magic, MMAP_MODEL_MAGIC, sizeof(MMAP_MODEL_MAGIC));
+  preamble.format_version = MMAP_MODEL_FORMAT_VERSION;
+  preamble.num_bits = all.initial_weights_config.num_bits;
+  preamble.stride_shift = weights.stride_shift();
+  preamble.model_state_offset = sizeof(preamble);
+  preamble.model_state_size = model_state->size();
+  const uint64_t state_end = preamble.model_state_offset + preamble.model_state_size;
+  preamble.weights_offset = (state_end + MMAP_MODEL_ALIGNMENT - 1) / MMAP_MODEL_ALIGNMENT * MMAP_MODEL_ALIGNMENT;
+  preamble.weights_size = weights.raw_length() * sizeof(VW::weight);
+
+  buf.bin_write_fixed(reinterpret_cast<const char*>(&preamble), sizeof(preamble));
+  buf.bin_write_fixed(model_state->data(), model_state->size());
+  std::vector<char> padding(static_cast<size_t>(preamble.weights_offset - state_end), 0);
+  buf.bin_write_fixed(padding.data(), padding.size());
+
+  const auto* raw_weights = reinterpret_cast<const char*>(weights.data());
+  for (uint64_t written = 0; written < preamble.weights_size; written += MMAP_MODEL_WRITE_CHUNK_SIZE)
+  {
+    const auto chunk_size =
+        static_cast<size_t>(std::min<uint64_t>(MMAP_MODEL_WRITE_CHUNK_SIZE, preamble.weights_size - written));
+    buf.bin_write_fixed(raw_weights + written, chunk_size);
+  }
+  buf.flush();
+  buf.close_file();
+}
+}  // namespace
+
 void VW::details::initialize_regressor(VW::workspace& all)
 {
-  if (all.weights.sparse) { ::initialize_regressor(all, all.weights.sparse_weights); }
+  if (all.weights.sparse)
+  {
+    if (!all.initial_weights_config.mapped_weights_file.empty())
+    {
+      THROW("Memory-mappable models cannot be loaded with --sparse_weights");
+    }
+    ::initialize_regressor(all, all.weights.sparse_weights);
+  }
+  else if (!all.initial_weights_config.mapped_weights_file.empty()) { map_initial_regressor(all); }
   else { ::initialize_regressor(all, all.weights.dense_weights); }
 }
 
@@ -502,7 +679,8 @@ void VW::details::dump_regressor(VW::workspace& all, const std::string& reg_name
   VW::io_buf io_temp;
   io_temp.add_file(VW::io::open_file_writer(start_name));
 
-  dump_regressor(all, io_temp, as_text);
+  if (!as_text && all.output_model_config.mmap_model) { dump_mmap_regressor(all, io_temp); }
+  else { dump_regressor(all, io_temp, as_text); }
 
   remove(reg_name.c_str());
 
@@ -547,7 +725,17 @@ void VW::details::read_regressor_file(
 {
   if (all_intial.size() > 0)
   {
-    io_temp.add_file(VW::io::open_file_reader(all_intial[0]));
+    auto reader = VW::io::open_file_reader(all_intial[0]);
+    mmap_model_preamble preamble;
+    if (read_mmap_model_preamble(*reader, all_intial[0], preamble))
+    {
+      all.initial_weights_config.mapped_weights_file = all_intial[0];
+      all.initial_weights_config.mapped_weights_offset = preamble.weights_offset;
+      all.initial_weights_config.mapped_weights_size = preamble.weights_size;
+      all.initial_weights_config.mapped_weights_stride_shift = preamble.stride_shift;
+      io_temp.add_file(VW::make_unique<limited_reader>(std::move(reader), preamble.model_state_size));
+    }
+    else { io_temp.add_file(VW::io::open_file_reader(all_intial[0])); }
 
     if (!all.output_config.quiet)
     {
@@ -68,6 +68,7 @@ int VW_GETPID() { return (int)::GetCurrentProcessId(); }
 #include "vw/core/parse_primitives.h"
 #include "vw/core/reductions/conditional_contextual_bandit.h"
 #include "vw/core/shared_data.h"
+#include "vw/core/thread_pool.h"
 #include "vw/core/unique_sort.h"
 #include "vw/core/vw.h"
 #include "vw/io/io_adapter.h"
@@ -77,6 +78,8 @@ int VW_GETPID() { return (int)::GetCurrentProcessId(); }
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
+#include <cstring>
+#include <deque>
 #ifdef VW_FEAT_FLATBUFFERS_ENABLED
 #  include "vw/fb_parser/parse_example_flatbuffer.h"
 #endif
@@ -120,14 +123,20 @@ void parse_example_label(string_view label, const VW::label_parser& lbl_parser,
 }
 }  // namespace VW
 
-uint32_t cache_numbits(VW::io::reader& cache_reader)
+uint32_t cache_numbits(VW::io::reader& cache_reader, bool& block_format)
 {
-  size_t version_buffer_length;
-  if (static_cast<size_t>(cache_reader.read(reinterpret_cast<char*>(&version_buffer_length),
-          sizeof(version_buffer_length))) < sizeof(version_buffer_length))
+  // The first bytes are either the magic of a block cache or the length of the version of a version 1 cache.
+  char first_bytes[sizeof(VW::parsers::cache::BLOCK_CACHE_MAGIC)];
+  static_assert(sizeof(first_bytes) == sizeof(size_t), "Magic must overlap the version length of version 1 caches");
+  if (static_cast<size_t>(cache_reader.read(first_bytes, sizeof(first_bytes))) < sizeof(first_bytes))
   {
     THROW("failed to read: version_buffer_length");
   }
+  block_format = VW::parsers::cache::is_block_cache_magic(first_bytes, sizeof(first_bytes));
+  if (block_format) { return VW::parsers::cache::read_block_cache_header(cache_reader); }
+
+  size_t version_buffer_length;
+  std::memcpy(&version_buffer_length, first_bytes, sizeof(version_buffer_length));
 
   if (version_buffer_length > 61) THROW("cache version too long, cache file is probably invalid");
   if (version_buffer_length == 0) THROW("cache version too short, cache file is probably invalid");
@@ -162,9 +171,23 @@ uint32_t cache_numbits(VW::io::reader& cache_reader)
   return cache_numbits;
 }
 
-void set_cache_reader(VW::workspace& all)
+void set_cache_reader(VW::workspace& all, bool block_format)
 {
-  all.parser_runtime.example_parser->reader = VW::parsers::cache::read_example_from_cache;
+  auto& p = *all.parser_runtime.example_parser;
+  if (block_format)
+  {
+    if (p.block_cache_reader == nullptr)
+    {
+      p.block_cache_reader = VW::make_unique<VW::parsers::cache::block_cache_reader>(p.parse_threads);
+    }
+    p.reader = VW::parsers::cache::read_example_from_block_cache;
+  }
+  else { p.reader = VW::parsers::cache::read_example_from_cache; }
+}
+
+std::unique_ptr<VW::io::reader> open_input_file(const VW::parser& p, const std::string& file_name)
+{
+  return p.mmap_input ? VW::io::open_mapped_file_reader(file_name) : VW::io::open_file_reader(file_name);
 }
 
 void set_string_reader(VW::workspace& all)
@@ -229,6 +252,12 @@ void VW::details::reset_source(VW::workspace& all, size_t numbits)
   // If in write cache mode then close all of the input files then open the written cache as the new input.
   if (all.parser_runtime.example_parser->write_cache)
   {
+    const bool block_format = all.parser_runtime.example_parser->block_cache_writer != nullptr;
+    if (block_format)
+    {
+      all.parser_runtime.example_parser->block_cache_writer->finish(all.parser_runtime.example_parser->output);
+      all.parser_runtime.example_parser->block_cache_writer.reset();
+    }
     all.parser_runtime.example_parser->output.flush();
     // Turn off write_cache as we are now reading it instead of writing!
     all.parser_runtime.example_parser->write_cache = false;
@@ -245,8 +274,14 @@ void VW::details::reset_source(VW::workspace& all, size_t numbits)
           << all.parser_runtime.example_parser->currentname << " to " << all.parser_runtime.example_parser->finalname);
     input.close_files();
     // Now open the written cache as the new input file.
-    input.add_file(VW::io::open_file_reader(all.parser_runtime.example_parser->finalname));
-    set_cache_reader(all);
+    input.add_file(open_input_file(*all.parser_runtime.example_parser, all.parser_runtime.example_parser->finalname));
+    set_cache_reader(all, block_format);
+    if (all.parser_runtime.example_parser->shuffle_blocks)
+    {
+      all.parser_runtime.example_parser->block_cache_reader->enable_shuffle(
+          {all.parser_runtime.example_parser->finalname}, all.get_random_state()->get_current_state(),
+          all.parser_runtime.example_parser->shuffle_window);
+    }
   }
 
   if (all.parser_runtime.example_parser->resettable == true)
@@ -292,9 +327,14 @@ void VW::details::reset_source(VW::workspace& all, size_t numbits)
     {
       if (!input.is_resettable()) { THROW("Cannot reset source as it is a non-resettable input type.") }
       input.reset();
+      if (all.parser_runtime.example_parser->block_cache_reader != nullptr)
+      {
+        all.parser_runtime.example_parser->block_cache_reader->reset();
+      }
       for (auto& file : input.get_input_files())
       {
-        const auto num_bits_cachefile = cache_numbits(*file);
+        bool block_format = false;
+        const auto num_bits_cachefile = cache_numbits(*file, block_format);
         if (num_bits_cachefile < numbits)
         {
           auto message =
@@ -307,7 +347,7 @@ void VW::details::reset_source(VW::workspace& all, size_t numbits)
   }
 }
 
-void make_write_cache(VW::workspace& all, std::string& newname, bool quiet)
+void make_write_cache(VW::workspace& all, std::string& newname, bool block_format, bool quiet)
 {
   VW::io_buf& output = all.parser_runtime.example_parser->output;
   if (output.num_files() != 0)
@@ -327,13 +367,21 @@ void make_write_cache(VW::workspace& all, std::string& newname, bool quiet)
     return;
   }
 
-  size_t v_length = static_cast<uint64_t>(VW::VERSION.to_string().length()) + 1;
+  if (block_format)
+  {
+    all.parser_runtime.example_parser->block_cache_writer = VW::make_unique<VW::parsers::cache::block_cache_writer>();
+    all.parser_runtime.example_parser->block_cache_writer->write_header(output, all.initial_weights_config.num_bits);
+  }
+  else
+  {
+    size_t v_length = static_cast<uint64_t>(VW::VERSION.to_string().length()) + 1;
 
-  output.bin_write_fixed(reinterpret_cast<const char*>(&v_length), sizeof(v_length));
-  output.bin_write_fixed(VW::VERSION.to_string().c_str(), v_length);
-  output.bin_write_fixed("c", 1);
-  output.bin_write_fixed(
-      reinterpret_cast<const char*>(&all.initial_weights_config.num_bits), sizeof(all.initial_weights_config.num_bits));
+    output.bin_write_fixed(reinterpret_cast<const char*>(&v_length), sizeof(v_length));
+    output.bin_write_fixed(VW::VERSION.to_string().c_str(), v_length);
+    output.bin_write_fixed("c", 1);
+    output.bin_write_fixed(reinterpret_cast<const char*>(&all.initial_weights_config.num_bits),
+        sizeof(all.initial_weights_config.num_bits));
+  }
   output.flush();
 
   all.parser_runtime.example_parser->finalname = newname;
@@ -341,9 +389,13 @@ void make_write_cache(VW::workspace& all, std::string& newname, bool quiet)
   if (!quiet) { *(all.output_runtime.trace_message) << "creating cache_file = " << newname << endl; }
 }
 
-void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool kill_cache, bool quiet)
+void parse_cache(
+    VW::workspace& all, std::vector<std::string> cache_files, bool kill_cache, bool write_block_format, bool quiet)
 {
   all.parser_runtime.example_parser->write_cache = false;
+  size_t num_block_caches = 0;
+  size_t num_caches_read = 0;
+  std::vector<std::string> block_cache_files;
 
   for (auto& file : cache_files)
   {
@@ -352,7 +404,7 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
     {
       try
       {
-        all.parser_runtime.example_parser->input.add_file(VW::io::open_file_reader(file));
+        all.parser_runtime.example_parser->input.add_file(open_input_file(*all.parser_runtime.example_parser, file));
         cache_file_opened = true;
       }
       catch (const std::exception&)
@@ -360,10 +412,11 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
         cache_file_opened = false;
       }
     }
-    if (cache_file_opened == false) { make_write_cache(all, file, quiet); }
+    if (cache_file_opened == false) { make_write_cache(all, file, write_block_format, quiet); }
     else
     {
-      uint64_t c = cache_numbits(*all.parser_runtime.example_parser->input.get_input_files().back());
+      bool block_format = false;
+      uint64_t c = cache_numbits(*all.parser_runtime.example_parser->input.get_input_files().back(), block_format);
       if (c < all.initial_weights_config.num_bits)
       {
         if (!quiet)
@@ -371,17 +424,43 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
           all.logger.err_warn("cache file is ignored as it's made with less bit precision than required.");
         }
         all.parser_runtime.example_parser->input.close_file();
-        make_write_cache(all, file, quiet);
+        make_write_cache(all, file, write_block_format, quiet);
       }
       else
       {
         if (!quiet) { *(all.output_runtime.trace_message) << "using cache_file = " << file.c_str() << endl; }
-        set_cache_reader(all);
+        num_caches_read++;
+        if (block_format)
+        {
+          num_block_caches++;
+          block_cache_files.push_back(file);
+        }
+        if (num_block_caches != 0 && num_block_caches != num_caches_read)
+        {
+          THROW("Cache files of --cache_format v1 and v2 cannot be read together");
+        }
+        set_cache_reader(all, block_format);
         all.parser_runtime.example_parser->resettable = true;
       }
     }
   }
 
+  if (all.parser_runtime.example_parser->shuffle_blocks)
+  {
+    if (cache_files.empty()) { THROW("--shuffle_blocks requires a cache, use --cache or --cache_file"); }
+    if (num_block_caches != num_caches_read ||
+        (all.parser_runtime.example_parser->write_cache &&
+            all.parser_runtime.example_parser->block_cache_writer == nullptr))
+    {
+      THROW("--shuffle_blocks requires a --cache_format v2 cache");
+    }
+    if (!block_cache_files.empty())
+    {
+      all.parser_runtime.example_parser->block_cache_reader->enable_shuffle(std::move(block_cache_files),
+          all.get_random_state()->get_current_state(), all.parser_runtime.example_parser->shuffle_window);
+    }
+  }
+
   all.runtime_state.parse_mask = (static_cast<uint64_t>(1) << all.initial_weights_config.num_bits) - 1;
   if (cache_files.size() == 0)
   {
@@ -397,7 +476,10 @@ void parse_cache(VW::workspace& all, std::vector<std::string> cache_files, bool
 void VW::details::enable_sources(
     VW::workspace& all, bool quiet, size_t passes, const VW::details::input_options& input_options)
 {
-  parse_cache(all, input_options.cache_files, input_options.kill_cache, quiet);
+  all.parser_runtime.example_parser->mmap_input = input_options.mmap_input;
+  all.parser_runtime.example_parser->shuffle_blocks = input_options.shuffle_blocks;
+  all.parser_runtime.example_parser->shuffle_window = VW::cast_to_smaller_type<size_t>(input_options.shuffle_window);
+  parse_cache(all, input_options.cache_files, input_options.kill_cache, input_options.cache_format == "v2", quiet);
 
   // default text reader
   all.parser_runtime.example_parser->text_reader = VW::parsers::text::read_lines;
@@ -496,6 +578,18 @@ void VW::details::enable_sources(
       THROW("daemon mode is not supported on Windows");
 #  else
       fclose(stdin);
+      if (input_options.daemon_threads > 0)
+      {
+#    ifndef __linux__
+        THROW("--daemon_threads is only supported on Linux");
+#    endif
+        if (input_options.json || input_options.dsjson) { THROW("--daemon_threads only supports text input"); }
+        // Clients are accepted by run_threaded_daemon once the workspace is fully set up.
+        all.parser_runtime.example_parser->daemon_threads =
+            VW::cast_to_smaller_type<size_t>(input_options.daemon_threads);
+        return;
+      }
+
       // weights will be shared across processes, accessible to children
       all.weights.share(all.length());
 
@@ -613,8 +707,10 @@ void VW::details::enable_sources(
         std::unique_ptr<VW::io::reader> adapter;
         if (!filename_to_read.empty())
         {
-          adapter = should_use_compressed ? VW::io::open_compressed_file_reader(filename_to_read)
-                                          : VW::io::open_file_reader(filename_to_read);
+          adapter = should_use_compressed
+              ? VW::io::open_threaded_compressed_file_reader(
+                    filename_to_read, VW::cast_to_smaller_type<size_t>(input_options.decompress_threads))
+              : open_input_file(*all.parser_runtime.example_parser, filename_to_read);
         }
         else if (!input_options.stdin_off)
         {
@@ -724,3 +820,196 @@ void VW::details::free_parser(VW::workspace& all)
   // There should be no examples in flight at this point.
   assert(all.parser_runtime.example_parser->ready_parsed_examples.size() == 0);
 }
+
+namespace
+{
+// Number of lines handed to a parse worker at a time. Large enough to amortize the task handoff, small enough that
+// the learner is not starved while the first batches are parsed.
+constexpr size_t PARSE_BATCH_SIZE = 64;
+
+class text_parse_batch
+{
+public:
+  std::string buffer;
+  // (offset, length) of each line within buffer.
+  std::vector<std::pair<size_t, size_t>> lines;
+  VW::multi_ex examples;
+  std::future<void> parsed;
+};
+
+void parse_text_batch(VW::workspace& all, text_parse_batch& batch)
+{
+  // Scratch space is per batch since the parser's own scratch space is shared between threads.
+  std::vector<VW::string_view> words;
+  VW::label_parser_reuse_mem reuse_mem;
+  for (size_t i = 0; i < batch.examples.size(); ++i)
+  {
+    VW::string_view line(batch.buffer.data() + batch.lines[i].first, batch.lines[i].second);
+    VW::parsers::text::details::substring_to_example(&all, batch.examples[i], line, words, reuse_mem);
+  }
+}
+
+void return_in_flight_batches(VW::workspace& all, std::deque<std::unique_ptr<text_parse_batch>>& in_flight)
+{
+  for (auto& batch : in_flight)
+  {
+    try
+    {
+      batch->parsed.get();
+    }
+    catch (...)
+    {
+      // The original error has already been reported, this batch is being discarded.
+    }
+    VW::return_multiple_example(all, batch->examples);
+  }
+  in_flight.clear();
+}
+}  // namespace
+
+void VW::details::parallel_parse_dispatch(
+    VW::workspace& all, const std::function<void(VW::workspace&, const VW::multi_ex&)>& dispatch)
+{
+  auto& p = *all.parser_runtime.example_parser;
+  // Blocks of a block cache are already decoded on parse_threads threads by the reader.
+  if (p.reader == &VW::parsers::cache::read_example_from_block_cache)
+  {
+    parse_dispatch(all, dispatch);
+    return;
+  }
+  if (p.reader != &VW::parsers::text::read_features_string
+#ifdef VW_FEAT_NETWORKING_ENABLED
+      || all.runtime_config.daemon
+#endif
+  )
+  {
+    all.logger.err_warn("--parse_threads is only supported for text input, parsing on a single thread.");
+    parse_dispatch(all, dispatch);
+    return;
+  }
+
+  VW::thread_pool pool(p.parse_threads);
+  // Bound the amount of parsed but undispatched input so that memory does not grow when the learner is slower.
+  const size_t max_in_flight = 2 * p.parse_threads;
+  std::deque<std::unique_ptr<text_parse_batch>> in_flight;
+  // Examples which have been taken off in_flight. Those before next_example have already been dispatched.
+  VW::multi_ex examples;
+  size_t next_example = 0;
+  size_t example_number = 0;  // for variable-size batch learning algorithms
+
+  auto dispatch_oldest_batch = [&]()
+  {
+    // The batch is parsed in place, its examples can only be taken once parsing has finished. If parsing failed the
+    // batch stays in flight so that its examples are returned.
+    in_flight.front()->parsed.get();
+    auto batch = std::move(in_flight.front());
+    in_flight.pop_front();
+    examples = std::move(batch->examples);
+    VW::multi_ex single_example;
+    for (next_example = 0; next_example < examples.size();)
+    {
+      single_example.assign(1, examples[next_example++]);
+      VW::setup_examples(all, single_example);
+      dispatch(all, single_example);
+    }
+    examples.clear();
+    next_example = 0;
+  };
+
+  auto return_undispatched_examples = [&]()
+  {
+    examples.erase(examples.begin(), examples.begin() + next_example);
+    VW::return_multiple_example(all, examples);
+    return_in_flight_batches(all, in_flight);
+  };
+
+  try
+  {
+    while (!p.done)
+    {
+      auto batch = VW::make_unique<text_parse_batch>();
+      bool end_of_pass = false;
+      while (batch->examples.size() < PARSE_BATCH_SIZE)
+      {
+        char* line = nullptr;
+        size_t num_chars = 0;
+        if (all.runtime_state.do_reset_source || example_number == all.runtime_config.pass_length ||
+            all.parser_runtime.max_examples <= example_number ||
+            VW::parsers::text::details::read_features(p.input, line, num_chars) < 1)
+        {
+          end_of_pass = true;
+          break;
+        }
+        // The line points into the input buffer which is overwritten by the next read, so it must be copied.
+        batch->lines.emplace_back(batch->buffer.size(), num_chars);
+        batch->buffer.append(line, num_chars);
+        batch->examples.push_back(&VW::get_unused_example(&all));
+        example_number++;
+      }
+
+      if (!batch->examples.empty())
+      {
+        auto* batch_ptr = batch.get();
+        batch_ptr->parsed = pool.submit([&all, batch_ptr]() { parse_text_batch(all, *batch_ptr); });
+        in_flight.push_back(std::move(batch));
+        if (in_flight.size() >= max_in_flight) { dispatch_oldest_batch(); }
+      }
+
+      if (!end_of_pass) { continue; }
+
+      // Everything read in this pass must reach the learner before the end_pass example.
+      while (!in_flight.empty()) { dispatch_oldest_batch(); }
+
+      examples.push_back(&VW::get_unused_example(&all));
+      VW::details::reset_source(all, all.initial_weights_config.num_bits);
+      all.runtime_state.do_reset_source = false;
+      all.runtime_state.passes_complete++;
+
+      // setup an end_pass example
+      p.lbl_parser.default_label(examples[0]->l);
+      examples[0]->end_pass = true;
+      p.in_pass_counter = 0;
+      // Since this example gets finished, we need to keep the counter correct.
+      p.num_setup_examples++;
+
+      if (all.runtime_state.passes_complete == all.runtime_config.numpasses &&
+          example_number == all.runtime_config.pass_length)
+      {
+        all.runtime_state.passes_complete = 0;
+        all.runtime_config.pass_length = all.runtime_config.pass_length * 2 + 1;
+      }
+      dispatch(all, examples);  // must be called before lock_done or race condition exists.
+      examples.clear();
+      if (all.runtime_state.passes_complete >= all.runtime_config.numpasses &&
+          all.parser_runtime.max_examples >= example_number)
+      {
+        VW::details::lock_done(p);
+      }
+      example_number = 0;
+
+      // When a cache was written during the first pass the following passes read the cache, which is not text.
+      if (!p.done && p.reader != &VW::parsers::text::read_features_string)
+      {
+        parse_dispatch(all, dispatch);
+        return;
+      }
+    }
+  }
+  catch (VW::vw_exception& e)
+  {
+    return_undispatched_examples();
+    all.logger.err_error("vw example #{0}({1}:{2}): {3}", example_number, e.filename(), e.line_number(), e.what());
+
+    // Stash the exception so it can be thrown on the main thread.
+    p.exc_ptr = std::current_exception();
+  }
+  catch (std::exception& e)
+  {
+    return_undispatched_examples();
+    all.logger.err_error("vw: example #{0}{1}", example_number, e.what());
+
+    // Stash the exception so it can be thrown on the main thread.
+    p.exc_ptr = std::current_exception();
+  }
+  VW::details::lock_done(p);
+}
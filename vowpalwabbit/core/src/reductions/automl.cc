@@ -141,7 +141,7 @@ std::shared_ptr<VW::LEARNER::learner> make_automl_with_impl(VW::setup_base_i& st
     std::string& oracle_type, uint64_t default_lease, VW::workspace& all, int32_t priority_challengers,
     std::string& interaction_type, std::string& priority_type, float automl_significance_level, bool ccb_on,
     bool predict_only_model, bool reversed_learning_order, config_type conf_type, bool trace_logging,
-    bool reward_as_cost, double tol_x, bool is_brentq)
+    bool reward_as_cost, double tol_x, bool is_brentq, uint64_t learn_threads)
 {
   using config_manager_type = interaction_config_manager<T, E>;
 
@@ -173,6 +173,8 @@ std::shared_ptr<VW::LEARNER::learner> make_automl_with_impl(VW::setup_base_i& st
   auto data = VW::make_unique<automl<config_manager_type>>(
       std::move(cm), &all.logger, predict_only_model, trace_file_name_prefix);
   data->debug_reverse_learning_order = reversed_learning_order;
+  data->all = &all;
+  data->learn_threads = learn_threads;
 
   auto feature_width = max_live_configs;
   auto* persist_ptr = verbose_metrics ? persist<config_manager_type, true> : persist<config_manager_type, false>;
@@ -212,6 +214,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
   bool reward_as_cost = false;
   float tol_x = 1e-6f;
   std::string opt_func = "bisect";
+  uint64_t learn_threads = 0;
 
   option_group_definition new_options("[Reduction] Automl");
   new_options
@@ -283,6 +286,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
                .keep()
                .one_of({"bisect", "brentq"})
                .help("Optimization function for estimation)")
+               .experimental())
+      .add(make_option("automl_threads", learn_threads)
+               .default_value(0)
+               .help("Number of threads which learn the challengers while the champ learns. 0 learns them one after "
+                     "another on the learning thread")
                .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
@@ -315,6 +323,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
 
   assert(all.weights.sparse == false);
   if (all.weights.sparse) THROW("--automl does not work with sparse weights");
+  if (learn_threads > 0) { VW::details::learner_replicas::check_supported(all); }
 
   VW::reductions::util::fail_if_enabled(all,
       {"ccb_explore_adf", "audit_regressor", "baseline", "cb_explore_adf_rnd", "cb_to_cb_adf", "cbify", "replay_c",
@@ -335,28 +344,28 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
       return make_automl_with_impl<config_oracle<one_diff_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, learn_threads);
     }
     else if (oracle_type == "rand")
     {
       return make_automl_with_impl<config_oracle<oracle_rand_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, learn_threads);
     }
     else if (oracle_type == "champdupe")
     {
       return make_automl_with_impl<config_oracle<champdupe_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, learn_threads);
     }
     else if (oracle_type == "one_diff_inclusion")
     {
       return make_automl_with_impl<config_oracle<one_diff_inclusion_impl>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, learn_threads);
     }
     else if (oracle_type == "qbase_cubic")
     {
@@ -365,7 +374,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::automl_setup(VW::setup_bas
       return make_automl_with_impl<config_oracle<qbase_cubic>, VW::estimators::confidence_sequence_robust>(
           stack_builder, learner, max_live_configs, verbose_metrics, oracle_type, default_lease, all,
           priority_challengers, interaction_type, priority_type, automl_significance_level, ccb_on, predict_only_model,
-          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq);
+          reversed_learning_order, conf_type, trace_logging, reward_as_cost, tol_x, is_brentq, learn_threads);
     }
   }
   else
@@ -1051,6 +1051,11 @@ void save_load_regularizer(VW::workspace& all, bfgs& b, VW::io_buf& model_file,
 void save_load(bfgs& b, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace* all = b.all;
+  // bfgs keeps its own regularizer and search state interleaved with the weights it serializes.
+  if (all->runtime_state.model_weights_external)
+  {
+    THROW("Memory-mappable models are not supported with --bfgs or --conjugate_gradient");
+  }
 
   uint32_t length = 1 << all->initial_weights_config.num_bits;
 
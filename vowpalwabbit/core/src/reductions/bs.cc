@@ -7,6 +7,7 @@
 #include "vw/config/options.h"
 #include "vw/core/global_data.h"
 #include "vw/core/learner.h"
+#include "vw/core/learner_replicas.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/setup_base.h"
 #include "vw/core/shared_data.h"
@@ -40,6 +41,10 @@ public:
   std::vector<double> pred_vec;
   VW::workspace* all = nullptr;  // for raw prediction and loss
   std::shared_ptr<VW::rand_state> random_state;
+  uint64_t ensemble_threads = 0;
+  std::unique_ptr<VW::details::learner_replicas> replicas;
+  std::vector<float> round_weights;
+  std::vector<float> partial_predictions;
 };
 
 void bs_predict_mean(const VW::workspace& all, VW::example& ec, const std::vector<double>& pred_vec)
@@ -179,19 +184,55 @@ void predict_or_learn(bs_data& d, learner& base, VW::example& ec)
   std::stringstream output_string_stream;
   d.pred_vec.clear();
 
-  for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+  if (d.ensemble_threads > 0)
   {
-    ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
-
-    if (is_learn) { base.learn(ec, i - 1); }
-    else { base.predict(ec, i - 1); }
-
-    d.pred_vec.push_back(ec.pred.scalar);
+    // The rounds' weights are drawn up front, in the same order as when the rounds run one after another.
+    d.round_weights.clear();
+    for (size_t i = 0; i < d.num_bootstrap_rounds; i++)
+    {
+      d.round_weights.push_back(weight_temp * static_cast<float>(bs::weight_gen(*d.random_state)));
+    }
+    d.pred_vec.assign(d.num_bootstrap_rounds, 0.);
+    d.partial_predictions.assign(d.num_bootstrap_rounds, 0.f);
 
-    if (should_output)
+    if (d.replicas == nullptr)
+    {
+      d.replicas = VW::make_unique<VW::details::learner_replicas>(
+          all, "bootstrap", d.ensemble_threads, std::vector<std::string>{"ensemble_threads"});
+    }
+    d.replicas->for_each_model(d.num_bootstrap_rounds, base, ec,
+        [&d](size_t i, learner& round_base, VW::example& round_ec)
+        {
+          round_ec.weight = d.round_weights[i];
+          if (is_learn) { round_base.learn(round_ec, i); }
+          else { round_base.predict(round_ec, i); }
+          d.pred_vec[i] = round_ec.pred.scalar;
+          d.partial_predictions[i] = round_ec.partial_prediction;
+        });
+    ec.partial_prediction = d.partial_predictions.back();
+
+    for (size_t i = 1; should_output && i <= d.num_bootstrap_rounds; i++)
     {
       if (i > 1) { output_string_stream << ' '; }
-      output_string_stream << i << ':' << ec.partial_prediction;
+      output_string_stream << i << ':' << d.partial_predictions[i - 1];
+    }
+  }
+  else
+  {
+    for (size_t i = 1; i <= d.num_bootstrap_rounds; i++)
+    {
+      ec.weight = weight_temp * static_cast<float>(bs::weight_gen(*d.random_state));
+
+      if (is_learn) { base.learn(ec, i - 1); }
+      else { base.predict(ec, i - 1); }
+
+      d.pred_vec.push_back(ec.pred.scalar);
+
+      if (should_output)
+      {
+        if (i > 1) { output_string_stream << ' '; }
+        output_string_stream << i << ':' << ec.partial_prediction;
+      }
     }
   }
 
@@ -232,7 +273,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bs_setup(VW::setup_base_i&
                .keep()
                .default_value("mean")
                .one_of({"mean", "vote"})
-               .help("Prediction type"));
+               .help("Prediction type"))
+      .add(make_option("ensemble_threads", data->ensemble_threads)
+               .default_value(0)
+               .help("Number of threads which learn and predict ensemble members alongside the learning thread")
+               .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
   size_t feature_width = data->num_bootstrap_rounds;
@@ -252,6 +297,10 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::bs_setup(VW::setup_base_i&
     data->bs_type = BS_TYPE_MEAN;
   }
 
+  if (data->ensemble_threads > 0) { VW::details::learner_replicas::check_supported(all); }
+  data->ensemble_threads = std::min<uint64_t>(
+      data->ensemble_threads, data->num_bootstrap_rounds > 0 ? data->num_bootstrap_rounds - 1 : 0);
+
   data->pred_vec.reserve(data->num_bootstrap_rounds);
   data->all = &all;
   data->random_state = all.get_random_state();
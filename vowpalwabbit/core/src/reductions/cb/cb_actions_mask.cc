@@ -51,7 +51,12 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_actions_mask_setup(VW::
   VW::config::options_i& options = *stack_builder.get_options();
   auto data = VW::make_unique<VW::reductions::cb_actions_mask>();
 
-  if (!options.was_supplied("large_action_space")) { return nullptr; }
+  // Both leave actions out of the ranking which the exploration is done over.
+  if (!options.was_supplied("large_action_space") &&
+      !(options.was_supplied("action_shortlist") && options.was_supplied("cb_explore_adf")))
+  {
+    return nullptr;
+  }
 
   auto base = require_multiline(stack_builder.setup_base_learner());
 
@@ -7,6 +7,7 @@
 #include "vw/common/string_view.h"
 #include "vw/common/vw_exception.h"
 #include "vw/config/options.h"
+#include "vw/core/gd_predict.h"
 #include "vw/core/label_dictionary.h"
 #include "vw/core/label_parser.h"
 #include "vw/core/print_utils.h"
@@ -21,6 +22,9 @@
 
 #include "vw/io/logger.h"
 
+#include <algorithm>
+#include <cfloat>
+
 using namespace VW::LEARNER;
 using namespace VW::config;
 
@@ -276,10 +280,61 @@ void VW::reductions::cb_adf::predict(learner& base, VW::multi_ex& ec_seq)
   _offset = ec_seq[0]->ft_offset;
   _offset_index = _offset / _all->weights.stride();
   _gen_cs_dr.known_cost = VW::get_observed_cost_or_default_cb_adf(ec_seq);  // need to set for test case
-  details::gen_cs_test_example(ec_seq, _cs_labels);                         // create test labels.
+  if (_action_shortlist > 0 && ec_seq.size() > _action_shortlist)
+  {
+    predict_shortlist(base, ec_seq);
+    return;
+  }
+  details::gen_cs_test_example(ec_seq, _cs_labels);  // create test labels.
   details::cs_ldf_learn_or_predict<false>(base, ec_seq, _cb_labels, _cs_labels, _prepped_cs_labels, false, _offset);
 }
 
+// The score of the features of ec without any interactions. It is much cheaper than the full score when interactions
+// with the shared features make up most of the features of an action.
+float VW::reductions::cb_adf::linear_score(const VW::example& ec) const
+{
+  VW::workspace& all = *_all;
+  float score = 0.f;
+  for (auto ns : ec.indices)
+  {
+    if (all.feature_tweaks_config.ignore_some_linear && all.feature_tweaks_config.ignore_linear[ns]) { continue; }
+    const auto& fs = ec.feature_space[ns];
+    if (all.weights.sparse)
+    {
+      VW::foreach_feature<float, VW::details::vec_add>(all.weights.sparse_weights, fs, score, _offset);
+    }
+    else { VW::foreach_feature<float, VW::details::vec_add>(all.weights.dense_weights, fs, score, _offset); }
+  }
+  return score;
+}
+
+// Predicts the _action_shortlist actions with the lowest linear_score with the base learner. The other actions are left
+// out of the ranking. This still reads the features of every action, so it saves the cost of the interactions but not
+// the cost of going over the actions.
+void VW::reductions::cb_adf::predict_shortlist(learner& base, VW::multi_ex& ec_seq)
+{
+  _linear_scores.clear();
+  for (uint32_t i = 0; i < ec_seq.size(); i++) { _linear_scores.push_back({i, linear_score(*ec_seq[i])}); }
+
+  const auto shortlist_end = _linear_scores.begin() + _action_shortlist;
+  std::nth_element(_linear_scores.begin(), shortlist_end, _linear_scores.end());
+  // The base learner sees the shortlisted actions in their original order, so that ties are broken as without it.
+  std::sort(_linear_scores.begin(), shortlist_end,
+      [](const VW::action_score& a, const VW::action_score& b) { return a.action < b.action; });
+
+  _shortlist.clear();
+  _cs_labels.costs.clear();
+  for (auto it = _linear_scores.begin(); it != shortlist_end; ++it)
+  {
+    _shortlist.push_back(ec_seq[it->action]);
+    _cs_labels.costs.push_back({FLT_MAX, it->action, 0.f, 0.f});
+  }
+  details::cs_ldf_learn_or_predict<false>(base, _shortlist, _cb_labels, _cs_labels, _prepped_cs_labels, false, _offset);
+
+  // csoaa_ldf stores the ranking in the first shortlisted action, but it is expected in the first action.
+  if (_shortlist[0] != ec_seq[0]) { std::swap(_shortlist[0]->pred.a_s, ec_seq[0]->pred.a_s); }
+}
+
 // how to
 
 bool VW::reductions::cb_adf::update_statistics(
@@ -436,6 +491,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_bas
   float clip_p;
   bool no_predict = false;
   bool per_model_save_load = false;
+  uint64_t action_shortlist = 0;
 
   option_group_definition new_options("[Reduction] Contextual Bandit with Action Dependent Features");
   new_options
@@ -457,7 +513,13 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_bas
       .add(make_option("per_model_save_load", per_model_save_load)
                .keep()
                .allow_override()
-               .help("Save and load per model state"));
+               .help("Save and load per model state"))
+      .add(make_option("action_shortlist", action_shortlist)
+               .default_value(0)
+               .experimental()
+               .help("When predicting, only rank the given number of actions with the lowest score without "
+                     "interactions. The other actions are left out of the ranking, and get probability 0 with "
+                     "--cb_explore_adf. Every action is still read. 0 ranks every action"));
   ;
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
@@ -474,6 +536,15 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_bas
     THROW("--indexing is not compatible with contextual bandits, please remove this option")
   }
 
+  if (action_shortlist > 0)
+  {
+    // These explorations or their estimates need a prediction for every action.
+    for (const char* option : {"large_action_space", "bag", "cover", "synthcover", "rnd", "regcb", "elim"})
+    {
+      if (options.was_supplied(option)) { THROW("--action_shortlist is not compatible with --" << option) }
+    }
+  }
+
   // number of weight vectors needed
   size_t feature_width = 1;  // default for IPS
   bool check_baseline_enabled = false;
@@ -512,8 +583,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_adf_setup(VW::setup_bas
 
   if (options.was_supplied("baseline") && check_baseline_enabled) { options.insert("check_enabled", ""); }
 
-  auto ld = VW::make_unique<VW::reductions::cb_adf>(
-      cb_type, rank_all, clip_p, no_predict, feature_width_above, per_model_save_load, &all);
+  auto ld = VW::make_unique<VW::reductions::cb_adf>(cb_type, rank_all, clip_p, no_predict, feature_width_above,
+      per_model_save_load, &all, static_cast<size_t>(action_shortlist));
 
   auto base = require_multiline(stack_builder.setup_base_learner(feature_width));
 
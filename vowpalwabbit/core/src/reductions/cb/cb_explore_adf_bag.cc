@@ -8,6 +8,8 @@
 #include "vw/core/gen_cs_example.h"
 #include "vw/core/global_data.h"
 #include "vw/core/label_parser.h"
+#include "vw/core/learner_replicas.h"
+#include "vw/core/memory.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/bs.h"
@@ -19,6 +21,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -34,8 +37,8 @@ class cb_explore_adf_bag
 public:
   using PredictionT = VW::v_array<VW::action_score>;
 
-  cb_explore_adf_bag(
-      float epsilon, size_t bag_size, bool greedify, bool first_only, std::shared_ptr<VW::rand_state> random_state);
+  cb_explore_adf_bag(float epsilon, size_t bag_size, bool greedify, bool first_only,
+      std::shared_ptr<VW::rand_state> random_state, VW::workspace* all, size_t ensemble_threads);
 
   // Should be called through cb_explore_adf_base for pre/post-processing
   void predict(VW::LEARNER::learner& base, VW::multi_ex& examples);
@@ -55,18 +58,38 @@ private:
   std::vector<float> _scores;
   std::vector<float> _top_actions;
   uint32_t get_bag_learner_update_count(uint32_t learner_index);
+
+  VW::workspace* _all;
+  size_t _ensemble_threads;
+  std::unique_ptr<VW::details::learner_replicas> _replicas;
+  std::vector<VW::v_array<VW::action_score>> _member_preds;
+  std::vector<uint32_t> _learn_counts;
+  VW::details::learner_replicas& replicas();
 };
 
-cb_explore_adf_bag::cb_explore_adf_bag(
-    float epsilon, size_t bag_size, bool greedify, bool first_only, std::shared_ptr<VW::rand_state> random_state)
+cb_explore_adf_bag::cb_explore_adf_bag(float epsilon, size_t bag_size, bool greedify, bool first_only,
+    std::shared_ptr<VW::rand_state> random_state, VW::workspace* all, size_t ensemble_threads)
     : _epsilon(epsilon)
     , _bag_size(bag_size)
     , _greedify(greedify)
     , _first_only(first_only)
     , _random_state(std::move(random_state))
+    , _all(all)
+    , _ensemble_threads(ensemble_threads)
 {
 }
 
+VW::details::learner_replicas& cb_explore_adf_bag::replicas()
+{
+  // The replicas are created on first use since the workspace is not complete while the stack is set up.
+  if (_replicas == nullptr)
+  {
+    _replicas = VW::make_unique<VW::details::learner_replicas>(
+        *_all, "cb_explore_adf_bag", _ensemble_threads, std::vector<std::string>{"ensemble_threads"});
+  }
+  return *_replicas;
+}
+
 uint32_t cb_explore_adf_bag::get_bag_learner_update_count(uint32_t learner_index)
 {
   // If _greedify then always update the first policy once
@@ -89,9 +112,23 @@ void cb_explore_adf_bag::predict(VW::LEARNER::learner& base, VW::multi_ex& examp
   _scores.assign(num_actions, 0.f);
   _top_actions.assign(num_actions, 0);
 
+  if (_ensemble_threads > 0)
+  {
+    // The members' predictions are combined below in the same order as when they are made one after another.
+    _member_preds.resize(_bag_size);
+    replicas().for_each_model(_bag_size, base, examples,
+        [this](size_t i, VW::LEARNER::learner& member_base, VW::multi_ex& member_examples)
+        {
+          VW::LEARNER::multiline_learn_or_predict<false>(
+              member_base, member_examples, member_examples[0]->ft_offset, VW::cast_to_smaller_type<uint32_t>(i));
+          _member_preds[i] = member_examples[0]->pred.a_s;
+        });
+  }
+
   for (uint32_t i = 0; i < _bag_size; i++)
   {
-    VW::LEARNER::multiline_learn_or_predict<false>(base, examples, examples[0]->ft_offset, i);
+    if (_ensemble_threads > 0) { preds = _member_preds[i]; }
+    else { VW::LEARNER::multiline_learn_or_predict<false>(base, examples, examples[0]->ft_offset, i); }
 
     assert(preds.size() == num_actions);
     for (auto e : preds) { _scores[e.action] += e.score; }
@@ -118,6 +155,23 @@ void cb_explore_adf_bag::predict(VW::LEARNER::learner& base, VW::multi_ex& examp
 
 void cb_explore_adf_bag::learn(VW::LEARNER::learner& base, VW::multi_ex& examples)
 {
+  if (_ensemble_threads > 0)
+  {
+    // The update counts are drawn up front, in the same order as when the members learn one after another.
+    _learn_counts.clear();
+    for (uint32_t i = 0; i < _bag_size; i++) { _learn_counts.push_back(get_bag_learner_update_count(i)); }
+    replicas().for_each_model(_bag_size, base, examples,
+        [this](size_t i, VW::LEARNER::learner& member_base, VW::multi_ex& member_examples)
+        {
+          for (uint32_t j = 0; j < _learn_counts[i]; j++)
+          {
+            VW::LEARNER::multiline_learn_or_predict<true>(
+                member_base, member_examples, member_examples[0]->ft_offset, VW::cast_to_smaller_type<uint32_t>(i));
+          }
+        });
+    return;
+  }
+
   for (uint32_t i = 0; i < _bag_size; i++)
   {
     // learn_count determines how many times learner (i) will learn from this
@@ -171,6 +225,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_bag_setup(V
   uint64_t bag_size = 0;
   bool greedify = false;
   bool first_only = false;
+  uint64_t ensemble_threads = 0;
   config::option_group_definition new_options("[Reduction] Contextual Bandit Exploration with ADF (bagging)");
   new_options
       .add(make_option("cb_explore_adf", cb_explore_adf_option)
@@ -181,7 +236,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_bag_setup(V
           make_option("epsilon", epsilon).keep().default_value(0.f).allow_override().help("Epsilon-greedy exploration"))
       .add(make_option("bag", bag_size).keep().necessary().help("Bagging-based exploration"))
       .add(make_option("greedify", greedify).keep().help("Always update first policy once in bagging"))
-      .add(make_option("first_only", first_only).keep().help("Only explore the first action in a tie-breaking event"));
+      .add(make_option("first_only", first_only).keep().help("Only explore the first action in a tie-breaking event"))
+      .add(make_option("ensemble_threads", ensemble_threads)
+               .default_value(0)
+               .help("Number of threads which learn and predict ensemble members alongside the learning thread")
+               .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -193,13 +252,17 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_bag_setup(V
   // predict before training is called.
   if (!options.was_supplied("no_predict")) { options.insert("no_predict", ""); }
 
+  if (ensemble_threads > 0) { VW::details::learner_replicas::check_supported(all); }
+  ensemble_threads = std::min<uint64_t>(ensemble_threads, bag_size > 0 ? bag_size - 1 : 0);
+
   size_t feature_width = VW::cast_to_smaller_type<size_t>(bag_size);
 
   auto base = require_multiline(stack_builder.setup_base_learner(feature_width));
 
   using explore_type = cb_explore_adf_base<cb_explore_adf_bag>;
   auto data = VW::make_unique<explore_type>(all.output_runtime.global_metrics.are_metrics_enabled(), epsilon,
-      VW::cast_to_smaller_type<size_t>(bag_size), greedify, first_only, all.get_random_state());
+      VW::cast_to_smaller_type<size_t>(bag_size), greedify, first_only, all.get_random_state(), &all,
+      VW::cast_to_smaller_type<size_t>(ensemble_threads));
   auto l = make_reduction_learner(std::move(data), base, explore_type::learn, explore_type::predict,
       stack_builder.get_setupfn_name(cb_explore_adf_bag_setup))
                .set_input_label_type(VW::label_type_t::CB)
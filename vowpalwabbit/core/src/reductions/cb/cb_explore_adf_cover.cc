@@ -8,6 +8,8 @@
 #include "vw/core/gen_cs_example.h"
 #include "vw/core/global_data.h"
 #include "vw/core/label_parser.h"
+#include "vw/core/learner_replicas.h"
+#include "vw/core/memory.h"
 #include "vw/core/numeric_casts.h"
 #include "vw/core/parser.h"
 #include "vw/core/reductions/bs.h"
@@ -22,6 +24,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <string>
 #include <vector>
 
 // All exploration algorithms return a vector of id, probability tuples, sorted in order of scores. The probabilities
@@ -36,7 +39,7 @@ class cb_explore_adf_cover
 public:
   cb_explore_adf_cover(size_t cover_size, float psi, bool nounif, float epsilon, bool epsilon_decay, bool first_only,
       VW::LEARNER::learner* cs_ldf_learner, VW::LEARNER::learner* scorer, VW::cb_type_t cb_type,
-      VW::version_struct model_file_version, VW::io::logger logger);
+      VW::version_struct model_file_version, VW::io::logger logger, VW::workspace* all, size_t ensemble_threads);
 
   // Should be called through cb_explore_adf_base for pre/post-processing
   void predict(VW::LEARNER::learner& base, VW::multi_ex& examples) { predict_or_learn_impl<false>(base, examples); }
@@ -67,11 +70,20 @@ private:
   std::vector<VW::cb_label> _cb_labels;
   template <bool is_learn>
   void predict_or_learn_impl(VW::LEARNER::learner& base, VW::multi_ex& examples);
+
+  // The policies depend on each other while learning, so only their predictions are made on several threads.
+  VW::workspace* _all;
+  size_t _ensemble_threads;
+  std::unique_ptr<VW::details::learner_replicas> _replicas;
+  std::vector<VW::action_scores> _policy_preds;
+  std::vector<std::vector<VW::cb_label>> _worker_cb_labels;
+  std::vector<std::vector<VW::cs_label>> _worker_prepped_cs_labels;
+  void predict_policies_in_parallel(VW::multi_ex& examples);
 };
 
 cb_explore_adf_cover::cb_explore_adf_cover(size_t cover_size, float psi, bool nounif, float epsilon, bool epsilon_decay,
     bool first_only, VW::LEARNER::learner* cs_ldf_learner, VW::LEARNER::learner* scorer, VW::cb_type_t cb_type,
-    VW::version_struct model_file_version, VW::io::logger logger)
+    VW::version_struct model_file_version, VW::io::logger logger, VW::workspace* all, size_t ensemble_threads)
     : _cover_size(cover_size)
     , _psi(psi)
     , _nounif(nounif)
@@ -83,10 +95,37 @@ cb_explore_adf_cover::cb_explore_adf_cover(size_t cover_size, float psi, bool no
     , _cb_type(cb_type)
     , _model_file_version(model_file_version)
     , _logger(std::move(logger))
+    , _all(all)
+    , _ensemble_threads(ensemble_threads)
 {
   _gen_cs_dr.scorer = scorer;
 }
 
+// Makes the predictions of policies 1 to _cover_size - 1 into _policy_preds.
+void cb_explore_adf_cover::predict_policies_in_parallel(VW::multi_ex& examples)
+{
+  // The replicas are created on first use since the workspace is not complete while the stack is set up. Their base
+  // learner is the cost sensitive learner below cb_adf.
+  if (_replicas == nullptr)
+  {
+    _replicas = VW::make_unique<VW::details::learner_replicas>(
+        *_all, "cb_adf", _ensemble_threads, std::vector<std::string>{"ensemble_threads"});
+    _worker_cb_labels.resize(_replicas->size() + 1);
+    _worker_prepped_cs_labels.resize(_replicas->size() + 1);
+  }
+
+  _policy_preds.resize(_cover_size);
+  const size_t num_workers = _replicas->size() + 1;
+  _replicas->for_each_model(_cover_size - 1, *_cs_ldf_learner, examples,
+      [this, num_workers](size_t model, VW::LEARNER::learner& cs_ldf_learner, VW::multi_ex& policy_examples)
+      {
+        const size_t worker = model % num_workers;
+        VW::details::cs_ldf_learn_or_predict<false>(cs_ldf_learner, policy_examples, _worker_cb_labels[worker],
+            _cs_labels, _worker_prepped_cs_labels[worker], false, policy_examples[0]->ft_offset, model + 2);
+        _policy_preds[model + 1] = policy_examples[0]->pred.a_s;
+      });
+}
+
 template <bool is_learn>
 void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::learner& base, VW::multi_ex& examples)
 {
@@ -148,6 +187,8 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::learner& base, VW:
   else { _action_probs[preds[0].action].score += additive_probability; }
 
   float norm = min_prob * num_actions + (additive_probability - min_prob);
+  const bool parallel_predict = !is_learn && _ensemble_threads > 0 && _cover_size > 1;
+  if (parallel_predict) { predict_policies_in_parallel(examples); }
   for (size_t i = 1; i < _cover_size; i++)
   {
     // Create costs of each action based on online cover
@@ -169,6 +210,7 @@ void cb_explore_adf_cover::predict_or_learn_impl(VW::LEARNER::learner& base, VW:
       VW::details::cs_ldf_learn_or_predict<true>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels_2,
           _prepped_cs_labels, true, examples[0]->ft_offset, i + 1);
     }
+    else if (parallel_predict) { preds = _policy_preds[i]; }
     else
     {
       VW::details::cs_ldf_learn_or_predict<false>(*(_cs_ldf_learner), examples, _cb_labels, _cs_labels,
@@ -248,6 +290,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_cover_setup
   bool nounif = false;
   bool first_only = false;
   float epsilon = 0.;
+  uint64_t ensemble_threads = 0;
 
   config::option_group_definition new_options("[Reduction] Contextual Bandit Exploration with ADF (online cover)");
   new_options
@@ -268,7 +311,11 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_cover_setup
                .keep()
                .allow_override()
                .default_value(0.05f)
-               .help("Epsilon-greedy exploration"));
+               .help("Epsilon-greedy exploration"))
+      .add(make_option("ensemble_threads", ensemble_threads)
+               .default_value(0)
+               .help("Number of threads which learn and predict ensemble members alongside the learning thread")
+               .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
 
@@ -300,6 +347,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_cover_setup
       break;
   }
 
+  if (ensemble_threads > 0) { VW::details::learner_replicas::check_supported(all); }
+  ensemble_threads = std::min<uint64_t>(ensemble_threads, cover_size > 1 ? cover_size - 2 : 0);
+
   // Set explore_type
   size_t feature_width = cover_size + 1;
 
@@ -326,7 +376,8 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::cb_explore_adf_cover_setup
   using explore_type = cb_explore_adf_base<cb_explore_adf_cover>;
   auto data = VW::make_unique<explore_type>(all.output_runtime.global_metrics.are_metrics_enabled(),
       VW::cast_to_smaller_type<size_t>(cover_size), psi, nounif, epsilon, epsilon_decay, first_only, cost_sensitive,
-      scorer, cb_type, all.runtime_state.model_file_ver, all.logger);
+      scorer, cb_type, all.runtime_state.model_file_ver, all.logger, &all,
+      VW::cast_to_smaller_type<size_t>(ensemble_threads));
   auto l = make_reduction_learner(std::move(data), base, explore_type::learn, explore_type::predict,
       stack_builder.get_setupfn_name(cb_explore_adf_cover_setup))
                .set_input_label_type(VW::label_type_t::CB)
@@ -233,6 +233,8 @@ inline void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool
 void save_load(cbzo& data, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *data.all;
+  // The initial constant is written into the weights on load, which would overwrite mapped weights.
+  if (all.runtime_state.model_weights_external) { THROW("Memory-mappable models are not supported with --cbzo"); }
   if (read)
   {
     VW::details::initialize_regressor(all);
@@ -52,6 +52,8 @@ public:
   uint64_t ft_offset = 0;
 
   std::vector<VW::action_scores> stored_preds;
+  // Offsets of the examples predicted by make_predictions.
+  std::vector<uint64_t> saved_offsets;
 };
 
 inline bool cmp_wclass_ptr(const VW::cs_class* a, const VW::cs_class* b) { return a->x < b->x; }
@@ -110,29 +112,37 @@ void unsubtract_example(VW::example* ec, VW::io::logger& logger)
   ec->indices.pop_back();
 }
 
-void make_single_prediction(ldf& data, learner& base, VW::example& ec)
+// Predicts every example of ec_seq as a simple example with its label features, in a single batch.
+void make_predictions(ldf& data, learner& base, VW::multi_ex& ec_seq)
 {
-  uint64_t old_offset = ec.ft_offset;
-
-  VW::details::append_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
-
+  data.saved_offsets.clear();
   auto restore_guard = VW::scope_exit(
-      [&data, old_offset, &ec]
+      [&data, &ec_seq]
       {
-        ec.ft_offset = old_offset;
-        // WARNING: Access of label information when making prediction is
-        // problematic.
-        ec.l.cs.costs[0].partial_prediction = ec.partial_prediction;
-        // WARNING: Access of label information when making prediction is
-        // problematic.
-        VW::details::truncate_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+        for (size_t k = 0; k < data.saved_offsets.size(); k++)
+        {
+          VW::example& ec = *ec_seq[k];
+          ec.ft_offset = data.saved_offsets[k];
+          // WARNING: Access of label information when making prediction is
+          // problematic.
+          ec.l.cs.costs[0].partial_prediction = ec.partial_prediction;
+          // WARNING: Access of label information when making prediction is
+          // problematic.
+          VW::details::truncate_example_namespace_from_memory(data.label_features, ec, ec.l.cs.costs[0].class_index);
+        }
       });
 
-  ec.l.simple = VW::simple_label{FLT_MAX};
-  ec.ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+  for (auto* ec : ec_seq)
+  {
+    VW::details::append_example_namespace_from_memory(data.label_features, *ec, ec->l.cs.costs[0].class_index);
+    data.saved_offsets.push_back(ec->ft_offset);
+
+    ec->l.simple = VW::simple_label{FLT_MAX};
+    ec->ex_reduction_features.template get<VW::simple_label_reduction_features>().reset_to_default();
+    ec->ft_offset = data.ft_offset;
+  }
 
-  ec.ft_offset = data.ft_offset;
-  base.predict(ec);  // make a prediction
+  base.predict_batch(ec_seq);  // make the predictions
 }
 
 bool test_ldf_sequence(const VW::multi_ex& ec_seq, VW::io::logger& logger)
@@ -357,11 +367,11 @@ void predict_csoaa_ldf(ldf& data, learner& base, VW::multi_ex& ec_seq_all)
       VW::scope_exit([&ec_seq_all, &predicted_class] { ec_seq_all[0]->pred.multiclass = predicted_class; });
 
   /////////////////////// do prediction
+  make_predictions(data, base, ec_seq_all);
   float min_score = FLT_MAX;
   for (uint32_t k = 0; k < num_classes; k++)
   {
     VW::example* ec = ec_seq_all[k];
-    make_single_prediction(data, base, *ec);
     if (ec->partial_prediction < min_score)
     {
       min_score = ec->partial_prediction;
@@ -382,7 +392,7 @@ void predict_csoaa_ldf_probabilities(ldf& data, learner& base, VW::multi_ex& ec_
       VW::scope_exit([&ec_seq_all] { convert_to_probabilities(ec_seq_all, ec_seq_all[0]->pred.scalars); });
 
   /////////////////////// do prediction
-  for (auto* ec : ec_seq_all) { make_single_prediction(data, base, *ec); }
+  make_predictions(data, base, ec_seq_all);
 }
 
 /*
@@ -417,11 +427,11 @@ void predict_csoaa_ldf_rank(ldf& data, learner& base, VW::multi_ex& ec_seq_all)
         }
       });
 
+  for (auto* ec : ec_seq_all) { data.stored_preds.emplace_back(std::move(ec->pred.a_s)); }
+  make_predictions(data, base, ec_seq_all);
   for (uint32_t k = 0; k < num_classes; k++)
   {
     VW::example* ec = ec_seq_all[k];
-    data.stored_preds.emplace_back(std::move(ec->pred.a_s));
-    make_single_prediction(data, base, *ec);
     VW::action_score s;
     s.score = ec->partial_prediction;
     s.action = ec->l.cs.costs[0].class_index;
@@ -6,8 +6,12 @@
 
 #include "vw/common/vw_exception.h"
 #include "vw/core/estimators/confidence_sequence_robust.h"
+#include "vw/core/memory.h"
 #include "vw/core/multi_model_utils.h"
 
+#include <algorithm>
+#include <vector>
+
 /*
 This reduction implements the ChaCha algorithm from page 5 of the following paper:
 https://arxiv.org/pdf/2106.04815.pdf
@@ -409,19 +413,23 @@ void automl<CMType>::offset_learn(LEARNER::learner& base, multi_ex& ec, VW::cb_c
         for (example* ex : ec) { ex->interactions = incoming_interactions; }
       });
 
-  // Learn and update estimators of challengers
-  for (int64_t current_slot_index = 1; static_cast<size_t>(current_slot_index) < cm->estimators.size();
-       ++current_slot_index)
+  if (learn_threads > 0 && cm->estimators.size() > 1) { parallel_learn(base, ec, labelled_action, w, r); }
+  else
   {
-    if (!debug_reverse_learning_order) { live_slot = current_slot_index; }
-    else { live_slot = cm->estimators.size() - current_slot_index; }
-    cm->do_learning(base, ec, live_slot);
-    cm->estimators[live_slot].first._estimator.update(ec[0]->pred.a_s[0].action == labelled_action ? w : 0, r);
-  }
+    // Learn and update estimators of challengers
+    for (int64_t current_slot_index = 1; static_cast<size_t>(current_slot_index) < cm->estimators.size();
+         ++current_slot_index)
+    {
+      if (!debug_reverse_learning_order) { live_slot = current_slot_index; }
+      else { live_slot = cm->estimators.size() - current_slot_index; }
+      cm->do_learning(base, ec, live_slot);
+      cm->estimators[live_slot].first._estimator.update(ec[0]->pred.a_s[0].action == labelled_action ? w : 0, r);
+    }
 
-  // ** Note: champ learning is done after to ensure correct feature count in gd **
-  // Learn and get action of champ
-  cm->do_learning(base, ec, current_champ);
+    // ** Note: champ learning is done after to ensure correct feature count in gd **
+    // Learn and get action of champ
+    cm->do_learning(base, ec, current_champ);
+  }
 
   if (ec.size() < 1) { return; }
 
@@ -438,6 +446,32 @@ void automl<CMType>::offset_learn(LEARNER::learner& base, multi_ex& ec, VW::cb_c
   }
 }
 
+template <typename CMType>
+void automl<CMType>::parallel_learn(LEARNER::learner& base, multi_ex& ec, uint64_t labelled_action, float w, float r)
+{
+  // The replicas are created on first use since the workspace is not complete while the stack is set up.
+  if (replicas == nullptr)
+  {
+    const auto num_replicas = std::min<size_t>(learn_threads, cm->max_live_configs - 1);
+    replicas = VW::make_unique<VW::details::learner_replicas>(
+        *all, "automl", num_replicas, std::vector<std::string>{"automl_threads", "csv_trace"});
+  }
+
+  // The champ in slot 0 is learned last on this thread, as in serial learning.
+  std::vector<uint32_t> chosen_actions(cm->estimators.size(), 0);
+  replicas->for_each_model(cm->estimators.size(), base, ec,
+      [this, &chosen_actions](size_t live_slot, LEARNER::learner& slot_base, multi_ex& slot_ec)
+      {
+        cm->do_learning(slot_base, slot_ec, live_slot);
+        chosen_actions[live_slot] = slot_ec[0]->pred.a_s[0].action;
+      });
+
+  for (size_t live_slot = 1; live_slot < cm->estimators.size(); ++live_slot)
+  {
+    cm->estimators[live_slot].first._estimator.update(chosen_actions[live_slot] == labelled_action ? w : 0, r);
+  }
+}
+
 template class automl<
     interaction_config_manager<config_oracle<oracle_rand_impl>, VW::estimators::confidence_sequence_robust>>;
 template class automl<
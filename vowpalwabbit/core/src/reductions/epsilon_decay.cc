@@ -19,6 +19,7 @@
 #include "vw/core/reductions/gd.h"
 #include "vw/core/setup_base.h"
 
+#include <algorithm>
 #include <utility>
 
 using namespace VW::config;
@@ -39,7 +40,7 @@ epsilon_decay_data::epsilon_decay_data(uint64_t model_count, uint64_t min_scope,
     double epsilon_decay_significance_level, double epsilon_decay_estimator_decay, dense_parameters& weights,
     std::string epsilon_decay_audit_str, bool constant_epsilon, uint32_t& feature_width, uint64_t min_champ_examples,
     float initial_epsilon, uint64_t shift_model_bounds, bool reward_as_cost, double tol_x, bool is_brentq,
-    bool predict_only_model, bool challenger_epsilon)
+    bool predict_only_model, bool challenger_epsilon, VW::workspace* all, uint64_t ensemble_threads)
     : _model_count(model_count)
     , _min_scope(min_scope)
     , _epsilon_decay_significance_level(epsilon_decay_significance_level)
@@ -54,6 +55,8 @@ epsilon_decay_data::epsilon_decay_data(uint64_t model_count, uint64_t min_scope,
     , _reward_as_cost(reward_as_cost)
     , _predict_only_model(predict_only_model)
     , _challenger_epsilon(challenger_epsilon)
+    , _all(all)
+    , _ensemble_threads(ensemble_threads)
 {
   _weight_indices.resize(model_count);
   conf_seq_estimators.reserve(model_count);
@@ -91,16 +94,22 @@ void epsilon_decay_data::update_weights(float init_ep, VW::LEARNER::learner& bas
 
     VW::action_scores champ_a_s;
 
+    if (_ensemble_threads > 0) { learn_models_in_parallel(init_ep, base, examples); }
+
     // Process each model, then update the upper/lower bounds for each model
     for (int64_t model_ind = model_count - 1; model_ind >= 0; --model_ind)
     {
-      if (!_constant_epsilon)
+      if (_ensemble_threads > 0) { examples[0]->pred.a_s = _model_preds[model_ind]; }
+      else
       {
-        ep_fts.epsilon = VW::reductions::epsilon_decay::decayed_epsilon(
-            init_ep, conf_seq_estimators[model_ind][model_ind].update_count);
+        if (!_constant_epsilon)
+        {
+          ep_fts.epsilon = VW::reductions::epsilon_decay::decayed_epsilon(
+              init_ep, conf_seq_estimators[model_ind][model_ind].update_count);
+        }
+        if (!base.learn_returns_prediction) { base.predict(examples, _weight_indices[model_ind]); }
+        base.learn(examples, _weight_indices[model_ind]);
       }
-      if (!base.learn_returns_prediction) { base.predict(examples, _weight_indices[model_ind]); }
-      base.learn(examples, _weight_indices[model_ind]);
 
       for (const auto& a_s : examples[0]->pred.a_s)
       {
@@ -145,6 +154,45 @@ void epsilon_decay_data::update_weights(float init_ep, VW::LEARNER::learner& bas
   }
 }
 
+// Learns every model like update_weights does, spread over the replicas by weight index, since the state of the base
+// learners stays with the weights when models are promoted. The predictions are kept in _model_preds.
+void epsilon_decay_data::learn_models_in_parallel(float init_ep, VW::LEARNER::learner& base, VW::multi_ex& examples)
+{
+  // The replicas are created on first use since the workspace is not complete while the stack is set up.
+  if (_replicas == nullptr)
+  {
+    _replicas = VW::make_unique<VW::details::learner_replicas>(*_all, "epsilon_decay", _ensemble_threads,
+        std::vector<std::string>{"ensemble_threads", "epsilon_decay_audit"});
+  }
+
+  const auto model_count = conf_seq_estimators.size();
+  _model_preds.resize(model_count);
+  _replicas->for_each_model(_model_count, base, examples,
+      [this, init_ep, model_count](size_t weight_index, VW::LEARNER::learner& model_base, VW::multi_ex& model_examples)
+      {
+        const auto model_ind = static_cast<size_t>(
+            std::find(_weight_indices.begin(), _weight_indices.end(), weight_index) - _weight_indices.begin());
+        if (model_ind >= model_count) { return; }
+        if (!_constant_epsilon)
+        {
+          auto& ep_fts =
+              model_examples[0]->ex_reduction_features.template get<VW::cb_explore_adf::greedy::reduction_features>();
+          ep_fts.epsilon = VW::reductions::epsilon_decay::decayed_epsilon(
+              init_ep, conf_seq_estimators[model_ind][model_ind].update_count);
+        }
+        if (!model_base.learn_returns_prediction) { model_base.predict(model_examples, weight_index); }
+        model_base.learn(model_examples, weight_index);
+        _model_preds[model_ind] = model_examples[0]->pred.a_s;
+      });
+
+  // Leave the epsilon of the last model learned one after another.
+  if (!_constant_epsilon)
+  {
+    examples[0]->ex_reduction_features.template get<VW::cb_explore_adf::greedy::reduction_features>().epsilon =
+        VW::reductions::epsilon_decay::decayed_epsilon(init_ep, conf_seq_estimators[0][0].update_count);
+  }
+}
+
 // Promote model and all those lower with distance swap_dist
 void epsilon_decay_data::promote_model(int64_t model_ind, int64_t swap_dist)
 {
@@ -345,7 +393,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::epsilon_decay_setup(VW::se
   uint64_t model_count;
   uint64_t min_scope;
   float epsilon_decay_significance_level;
-  float epsilon_decay_estimator_decay;
+  float epsilon_decay_estimator_decay = 0.f;
   std::string epsilon_decay_audit_str;
   bool constant_epsilon = false;
   uint64_t bonferroni_denominator;
@@ -356,6 +404,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::epsilon_decay_setup(VW::se
   float tol_x;
   std::string opt_func = "bisect";
   bool challenger_epsilon = false;
+  uint64_t ensemble_threads = 0;
 
   option_group_definition new_options("[Reduction] Epsilon-Decaying Exploration");
   new_options
@@ -426,6 +475,10 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::epsilon_decay_setup(VW::se
       .add(make_option("challenger_epsilon", challenger_epsilon)
                .keep()
                .help("Use exploration for challenger model predictions")
+               .experimental())
+      .add(make_option("ensemble_threads", ensemble_threads)
+               .default_value(0)
+               .help("Number of threads which learn and predict ensemble members alongside the learning thread")
                .experimental());
 
   if (!options.add_parse_and_check_necessary(new_options)) { return nullptr; }
@@ -437,11 +490,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::epsilon_decay_setup(VW::se
 
   bool predict_only_model = options.was_supplied("predict_only_model");
   bool is_brentq = opt_func == "brentq";
+  if (ensemble_threads > 0) { VW::details::learner_replicas::check_supported(all); }
+  ensemble_threads = std::min(ensemble_threads, model_count - 1);
 
   auto data = VW::make_unique<VW::reductions::epsilon_decay::epsilon_decay_data>(model_count, min_scope,
       epsilon_decay_significance_level, epsilon_decay_estimator_decay, all.weights.dense_weights,
       epsilon_decay_audit_str, constant_epsilon, all.reduction_state.total_feature_width, min_champ_examples,
-      initial_epsilon, shift_model_bounds, reward_as_cost, tol_x, is_brentq, predict_only_model, challenger_epsilon);
+      initial_epsilon, shift_model_bounds, reward_as_cost, tol_x, is_brentq, predict_only_model, challenger_epsilon,
+      &all, ensemble_threads);
 
   // make sure we setup the rest of the stack with cleared interactions
   // to make sure there are not subtle bugs
@@ -13,6 +13,7 @@
 #include "vw/core/loss_functions.h"
 #include "vw/core/prediction_type.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/shared_score_reduction_features.h"
 
 #include <algorithm>
 #include <cfloat>
@@ -109,6 +110,11 @@ void subtract_weights(WeightsT& dest, const WeightsT& lhs, const WeightsT& rhs,
   for (size_t i = 0; i < full_weights_size; i++) { dest[i] = lhs[i] - rhs[i]; }
 }
 
+bool weights_mapped_read_only(const VW::workspace& all)
+{
+  return !all.initial_weights_config.mapped_weights_file.empty() && all.initial_weights_config.mapped_weights_read_only;
+}
+
 void sync_weights(VW::workspace& all)
 {
   // todo, fix length dependence
@@ -116,6 +122,9 @@ void sync_weights(VW::workspace& all)
   {  // to avoid unnecessary weight synchronization
     return;
   }
+  // A read-only mapping cannot be written. Predictions apply the contraction instead, and l1 state is rejected when
+  // such a model is loaded.
+  if (weights_mapped_read_only(all)) { return; }
 
   if (all.weights.sparse)
   {
@@ -215,8 +224,8 @@ void train(VW::reductions::gd& g, VW::example& ec, float update)
 {
   if VW_STD17_CONSTEXPR (normalized != 0) { update *= g.update_multiplier; }
   VW_DBG(ec) << "gd: train() spare=" << spare << std::endl;
-  VW::foreach_feature<float, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>>(
-      *g.all, ec, update);
+  VW::foreach_feature<float, update_feature<sqrt_rate, feature_mask_off, adaptive, normalized, spare>,
+      VW::details::WEIGHT_PREFETCH_DISTANCE>(*g.all, ec, update);
 }
 
 void end_pass(VW::reductions::gd& g)
@@ -508,10 +517,57 @@ inline float trunc_predict(VW::workspace& all, VW::example& ec, double gravity,
 {
   const auto& simple_red_features = ec.ex_reduction_features.template get<VW::simple_label_reduction_features>();
   trunc_data temp = {simple_red_features.initial, static_cast<float>(gravity)};
-  VW::foreach_feature<trunc_data, vec_add_trunc>(all, ec, temp, num_interacted_features);
+  VW::foreach_feature<trunc_data, vec_add_trunc, VW::details::WEIGHT_PREFETCH_DISTANCE>(
+      all, ec, temp, num_interacted_features);
   return temp.prediction;
 }
 
+// Linear score of the shared namespaces which shared_feature_merger did not copy into the actions. It is the same for
+// every action, so it is only computed for the first action predicted at each offset.
+template <bool l1>
+float shared_linear_score(VW::workspace& all, VW::shared_feature_merger::shared_score& shared, uint64_t offset)
+{
+  for (const auto& score : shared.linear_scores)
+  {
+    if (score.first == offset) { return score.second; }
+  }
+
+  float score = 0.f;
+  trunc_data trunc = {0.f, static_cast<float>(all.sd->gravity)};
+  for (auto ns : shared.namespaces)
+  {
+    if (all.feature_tweaks_config.ignore_some_linear && all.feature_tweaks_config.ignore_linear[ns]) { continue; }
+    const auto& fs = shared.shared_example->feature_space[ns];
+    if (l1)
+    {
+      if (all.weights.sparse)
+      {
+        VW::foreach_feature<trunc_data, vec_add_trunc>(all.weights.sparse_weights, fs, trunc, offset);
+      }
+      else { VW::foreach_feature<trunc_data, vec_add_trunc>(all.weights.dense_weights, fs, trunc, offset); }
+    }
+    else
+    {
+      if (all.weights.sparse)
+      {
+        VW::foreach_feature<float, VW::details::vec_add>(all.weights.sparse_weights, fs, score, offset);
+      }
+      else { VW::foreach_feature<float, VW::details::vec_add>(all.weights.dense_weights, fs, score, offset); }
+    }
+  }
+  if (l1) { score = trunc.prediction; }
+
+  shared.linear_scores.emplace_back(offset, score);
+  return score;
+}
+
+// Swaps the shared namespaces which shared_feature_merger did not copy into ec with the empty namespaces of ec. They
+// are not added to ec.indices, so only interactions see them.
+void swap_shared_namespaces(VW::example& ec, VW::shared_feature_merger::shared_score& shared)
+{
+  for (auto ns : shared.namespaces) { std::swap(ec.feature_space[ns], shared.shared_example->feature_space[ns]); }
+}
+
 template <bool l1, bool audit>
 void predict(VW::reductions::gd& g, VW::example& ec)
 {
@@ -519,8 +575,15 @@ void predict(VW::reductions::gd& g, VW::example& ec)
 
   VW::workspace& all = *g.all;
   size_t num_interacted_features = 0;
+  auto* shared = ec.ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>().shared;
+  if (shared != nullptr) { swap_shared_namespaces(ec, *shared); }
   if (l1) { ec.partial_prediction = trunc_predict(all, ec, all.sd->gravity, num_interacted_features); }
   else { ec.partial_prediction = inline_predict(all, ec, num_interacted_features); }
+  if (shared != nullptr)
+  {
+    swap_shared_namespaces(ec, *shared);
+    ec.partial_prediction += shared_linear_score<l1>(all, *shared, ec.ft_offset);
+  }
 
   ec.num_features_from_interactions = num_interacted_features;
   ec.partial_prediction *= static_cast<float>(all.sd->contraction);
@@ -532,6 +595,26 @@ void predict(VW::reductions::gd& g, VW::example& ec)
   if (audit) { VW::details::print_audit_features(all, ec); }
 }
 
+// Starts loading the weights of the features of ec, so that they are in the cache once ec is predicted.
+inline void prefetch_weights(const VW::dense_parameters& weights, const VW::example& ec)
+{
+  for (auto ns : ec.indices)
+  {
+    for (auto index : ec.feature_space[ns].indices) { weights.prefetch(index + ec.ft_offset); }
+  }
+}
+
+template <bool l1, bool audit>
+void predict_batch(VW::reductions::gd& g, VW::multi_ex& examples)
+{
+  const bool prefetch = !g.all->weights.sparse;
+  for (size_t i = 0; i < examples.size(); i++)
+  {
+    if (prefetch && i + 1 < examples.size()) { prefetch_weights(g.all->weights.dense_weights, *examples[i + 1]); }
+    predict<l1, audit>(g, *examples[i]);
+  }
+}
+
 template <class T>
 inline void vec_add_trunc_multipredict(VW::details::multipredict_info<T>& mp, const float fx, uint64_t fi)
 {
@@ -542,6 +625,66 @@ inline void vec_add_trunc_multipredict(VW::details::multipredict_info<T>& mp, co
   }
 }
 
+// Like multipredict_info<dense_parameters>, but the scores are contiguous rather than spread over polypredictions.
+class dense_multipredict_info
+{
+public:
+  size_t count;
+  size_t step;
+  float* scores;
+  const VW::dense_parameters& weights;
+};
+
+// The weights of the classes of a feature are step apart. With the one, two or four weights per feature of sgd,
+// adaptive or normalized, and the default update, four classes are added at once.
+inline void vec_add_dense_multipredict(dense_multipredict_info& mp, const float fx, uint64_t fi)
+{
+  if ((-1e-10 < fx) && (fx < 1e-10)) { return; }
+  const uint64_t mask = mp.weights.mask();
+  fi &= mask;
+  float* scores = mp.scores;
+  size_t c = 0;
+  if (fi + mp.count * mp.step > mask + 1)
+  {
+    for (; c < mp.count; c++, fi += mp.step) { scores[c] += fx * mp.weights[fi]; }
+    return;
+  }
+
+  const VW::weight* w = mp.weights.data() + fi;
+#if !defined(VW_NO_INLINE_SIMD) && !defined(__ARM_NEON__) && defined(__SSE2__)
+  const __m128 x = _mm_set1_ps(fx);
+  if (mp.step == 1)
+  {
+    for (; c + 4 <= mp.count; c += 4)
+    {
+      const __m128 ws = _mm_loadu_ps(w + c);
+      _mm_storeu_ps(scores + c, _mm_add_ps(_mm_loadu_ps(scores + c), _mm_mul_ps(x, ws)));
+    }
+  }
+  else if (mp.step == 2)
+  {
+    for (; c + 4 <= mp.count; c += 4)
+    {
+      const VW::weight* wc = w + 2 * c;
+      const __m128 ws = _mm_shuffle_ps(_mm_loadu_ps(wc), _mm_loadu_ps(wc + 4), _MM_SHUFFLE(2, 0, 2, 0));
+      _mm_storeu_ps(scores + c, _mm_add_ps(_mm_loadu_ps(scores + c), _mm_mul_ps(x, ws)));
+    }
+  }
+  else if (mp.step == 4)
+  {
+    for (; c + 4 <= mp.count; c += 4)
+    {
+      const VW::weight* wc = w + 4 * c;
+      const __m128 w01 = _mm_unpacklo_ps(_mm_loadu_ps(wc), _mm_loadu_ps(wc + 4));
+      const __m128 w23 = _mm_unpacklo_ps(_mm_loadu_ps(wc + 8), _mm_loadu_ps(wc + 12));
+      const __m128 ws = _mm_movelh_ps(w01, w23);
+      _mm_storeu_ps(scores + c, _mm_add_ps(_mm_loadu_ps(scores + c), _mm_mul_ps(x, ws)));
+    }
+  }
+#endif
+  for (; c < mp.count; c++) { scores[c] += fx * w[c * mp.step]; }
+}
+
 template <bool l1, bool audit>
 void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t step, VW::polyprediction* pred,
     bool finalize_predictions)
@@ -571,17 +714,22 @@ void multipredict(VW::reductions::gd& g, VW::example& ec, size_t count, size_t s
   }
   else
   {
-    VW::details::multipredict_info<VW::dense_parameters> mp = {
-        count, step, pred, g.all->weights.dense_weights, static_cast<float>(all.sd->gravity)};
     if (l1)
     {
+      VW::details::multipredict_info<VW::dense_parameters> mp = {
+          count, step, pred, g.all->weights.dense_weights, static_cast<float>(all.sd->gravity)};
       VW::foreach_feature<VW::details::multipredict_info<VW::dense_parameters>, uint64_t, vec_add_trunc_multipredict>(
           all, ec, mp, num_features_from_interactions);
     }
     else
     {
-      VW::foreach_feature<VW::details::multipredict_info<VW::dense_parameters>, uint64_t,
-          VW::details::vec_add_multipredict>(all, ec, mp, num_features_from_interactions);
+      auto& scores = g.multipredict_scores;
+      scores.resize(count);
+      for (size_t c = 0; c < count; c++) { scores[c] = pred[c].scalar; }
+      dense_multipredict_info mp = {count, step, scores.data(), g.all->weights.dense_weights};
+      VW::foreach_feature<dense_multipredict_info, uint64_t, vec_add_dense_multipredict>(
+          all, ec, mp, num_features_from_interactions);
+      for (size_t c = 0; c < count; c++) { pred[c].scalar = scores[c]; }
     }
   }
   ec.num_features_from_interactions = num_features_from_interactions;
@@ -976,6 +1124,7 @@ void save_load_regressor(VW::workspace& all, VW::io_buf& model_file, bool read,
 
 void VW::details::save_load_regressor_gd(VW::workspace& all, VW::io_buf& model_file, bool read, bool text)
 {
+  if (all.runtime_state.model_weights_external) { return; }
   if (all.weights.sparse) { ::save_load_regressor(all, model_file, read, text, all.weights.sparse_weights); }
   else { ::save_load_regressor(all, model_file, read, text, all.weights.dense_weights); }
 }
@@ -1275,6 +1424,7 @@ void VW::details::save_load_online_state_gd(VW::workspace& all, VW::io_buf& mode
     all.sd->total_features = 0;
     all.passes_config.current_pass = 0;
   }
+  if (all.runtime_state.model_weights_external) { return; }
   if (all.weights.sparse)
   {
     save_load_online_state_weights(all, model_file, read, text, g, msg, ftrl_size, all.weights.sparse_weights);
@@ -1287,10 +1437,11 @@ namespace
 void save_load(VW::reductions::gd& g, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *g.all;
-  if (read)
-  {
-    VW::details::initialize_regressor(all);
+  if (read) { VW::details::initialize_regressor(all); }
 
+  // Weights stored outside of the model stream are mapped with their final values already.
+  if (read && !all.runtime_state.model_weights_external)
+  {
     if (all.weights.adaptive && all.update_rule_config.initial_t > 0)
     {
       float init_weight = all.initial_weights_config.initial_weight;
@@ -1339,6 +1490,10 @@ void save_load(VW::reductions::gd& g, VW::io_buf& model_file, bool read, bool te
   if (!all.runtime_config.training)
   {  // If the regressor was saved without --predict_only_model, then when testing we want to
      // materialize the weights.
+    if (weights_mapped_read_only(all) && all.sd->gravity != 0.)
+    {
+      THROW("--mmap_read_only cannot be used with models that have l1 regularization state");
+    }
     sync_weights(all);
   }
 }
@@ -1578,29 +1733,39 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
     {
       g->predict = ::predict<true, true>;
       g->multipredict = ::multipredict<true, true>;
+      g->predict_batch = ::predict_batch<true, true>;
     }
     else
     {
       g->predict = ::predict<true, false>;
       g->multipredict = ::multipredict<true, false>;
+      g->predict_batch = ::predict_batch<true, false>;
     }
   }
   else if (all.output_config.audit || all.output_config.hash_inv)
   {
     g->predict = ::predict<false, true>;
     g->multipredict = ::multipredict<false, true>;
+    g->predict_batch = ::predict_batch<false, true>;
   }
   else
   {
     g->predict = ::predict<false, false>;
     g->multipredict = ::multipredict<false, false>;
+    g->predict_batch = ::predict_batch<false, false>;
   }
 
   uint64_t stride;
   if (all.update_rule_config.power_t == 0.5) { stride = ::set_learn<true>(all, feature_mask_off, *g.get()); }
   else { stride = ::set_learn<false>(all, feature_mask_off, *g.get()); }
 
-  all.weights.stride_shift(static_cast<uint32_t>(::ceil_log_2(stride - 1)));
+  auto stride_shift = static_cast<uint32_t>(::ceil_log_2(stride - 1));
+  // Memory-mapped weights keep the layout they were saved with, which is wider than needed when only testing.
+  if (!all.initial_weights_config.mapped_weights_file.empty())
+  {
+    stride_shift = std::max(stride_shift, all.initial_weights_config.mapped_weights_stride_shift);
+  }
+  all.weights.stride_shift(stride_shift);
 
   auto* bare = g.get();
   auto l = make_bottom_learner(std::move(g), g->learn, bare->predict, stack_builder.get_setupfn_name(gd_setup),
@@ -1608,6 +1773,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::gd_setup(VW::setup_base_i&
                .set_learn_returns_prediction(true)
                .set_sensitivity(bare->sensitivity)
                .set_multipredict(bare->multipredict)
+               .set_predict_batch(bare->predict_batch)
                .set_update(bare->update)
                .set_save_load(::save_load)
                .set_end_pass(::end_pass)
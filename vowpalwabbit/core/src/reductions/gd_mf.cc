@@ -263,7 +263,8 @@ void save_load(gdmf& d, VW::io_buf& model_file, bool read, bool text)
   if (read)
   {
     VW::details::initialize_regressor(all);
-    if (all.initial_weights_config.random_weights)
+    // Weights stored outside of the model stream are mapped with their final values already.
+    if (all.initial_weights_config.random_weights && !all.runtime_state.model_weights_external)
     {
       uint32_t stride = all.weights.stride();
       auto weight_initializer = [stride](VW::weight* weights, uint64_t index)
@@ -273,7 +274,7 @@ void save_load(gdmf& d, VW::io_buf& model_file, bool read, bool text)
     }
   }
 
-  if (model_file.num_files() > 0)
+  if (model_file.num_files() > 0 && !all.runtime_state.model_weights_external)
   {
     if (!all.weights.not_null())
     {
@@ -9,6 +9,7 @@
 #include "vw/core/interactions.h"
 #include "vw/core/learner.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/shared_score_reduction_features.h"
 #include "vw/core/v_array.h"
 #include "vw/core/vw_math.h"
 #include "vw/io/logger.h"
@@ -22,12 +23,26 @@ using namespace VW::config;
 
 namespace
 {
+// shared_feature_merger leaves the namespaces in shared_score out of ec.indices, see
+// shared_score_reduction_features.h.
+template <VW::generate_func_t<VW::namespace_index> generate_func, bool leave_duplicate_interactions>
+void update_with_shared_namespaces(VW::interactions_generator& data, const VW::example& ec)
+{
+  const auto* shared = ec.ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>().shared;
+  if (shared != nullptr)
+  {
+    data.update_interactions_if_new_namespace_seen<generate_func, leave_duplicate_interactions>(
+        *ec.interactions, shared->namespaces);
+  }
+}
+
 template <bool is_learn, VW::generate_func_t<VW::namespace_index> generate_func, bool leave_duplicate_interactions>
 void transform_single_ex(VW::interactions_generator& data, VW::LEARNER::learner& base, VW::example& ec)
 {
   // We pass *ec.interactions here BUT the contract is that this does not change...
   data.update_interactions_if_new_namespace_seen<generate_func, leave_duplicate_interactions>(
       *ec.interactions, ec.indices);
+  update_with_shared_namespaces<generate_func, leave_duplicate_interactions>(data, ec);
 
   auto* saved_interactions = ec.interactions;
   ec.interactions = &data.generated_interactions;
@@ -50,6 +65,7 @@ void transform_single_ex(VW::interactions_generator& data, VW::LEARNER::learner&
   // We pass *ec.interactions here BUT the contract is that this does not change...
   data.update_interactions_if_new_namespace_seen<generate_func, leave_duplicate_interactions>(
       *ec.interactions, ec.indices);
+  update_with_shared_namespaces<generate_func, leave_duplicate_interactions>(data, ec);
 
   auto* saved_interactions = ec.interactions;
   ec.interactions = &data.generated_interactions;
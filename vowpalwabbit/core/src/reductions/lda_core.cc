@@ -766,6 +766,16 @@ void save_load(lda& l, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *(l.all);
   uint64_t length = static_cast<uint64_t>(1) << all.initial_weights_config.num_bits;
+  // Weights stored outside of the model stream are mapped with their final values already.
+  if (all.runtime_state.model_weights_external)
+  {
+    if (read && all.initial_weights_config.mapped_weights_read_only)
+    {
+      THROW("--mmap_read_only is not supported with --lda, which updates its weights while predicting");
+    }
+    if (read) { VW::details::initialize_regressor(all); }
+    return;
+  }
   if (read)
   {
     VW::details::initialize_regressor(all);
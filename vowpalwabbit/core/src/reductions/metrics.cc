@@ -8,6 +8,7 @@
 #include "vw/core/crossplat_compat.h"
 #include "vw/core/debug_log.h"
 #include "vw/core/global_data.h"
+#include "vw/core/hash_cache.h"
 #include "vw/core/learner.h"
 #include "vw/core/parser.h"
 #include "vw/core/scope_exit.h"
@@ -138,6 +139,13 @@ void additional_metrics(VW::workspace& all, VW::metric_sink& sink)
 {
   sink.set_uint("total_log_calls", all.logger.get_log_count());
 
+  if (all.parser_runtime.example_parser->feature_hash_cache != nullptr)
+  {
+    const auto stats = all.parser_runtime.example_parser->feature_hash_cache->get_stats();
+    sink.set_uint("hash_cache_hits", stats.hits);
+    sink.set_uint("hash_cache_misses", stats.misses);
+  }
+
   std::vector<std::string> enabled_learners;
   if (all.l != nullptr) { all.l->get_enabled_learners(enabled_learners); }
   insert_dsjson_metrics(all.parser_runtime.example_parser->metrics.get(), sink, enabled_learners);
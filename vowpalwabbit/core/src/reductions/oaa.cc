@@ -243,6 +243,13 @@ void predict(oaa& o, VW::LEARNER::learner& base, VW::example& ec)
   else { ec.pred.multiclass = prediction; }
 }
 
+// Every example is already scored for all classes by a single multipredict call, batching saves the dispatch to oaa.
+template <bool print_all, bool scores, bool probabilities>
+void predict_batch(oaa& o, VW::LEARNER::learner& base, VW::multi_ex& examples)
+{
+  for (auto* ec : examples) { predict<print_all, scores, probabilities>(o, base, *ec); }
+}
+
 template <bool probabilities>
 void update_stats_oaa(const VW::workspace& /* all */, VW::shared_data& sd, const oaa& data, const VW::example& ec,
     VW::io::logger& /* logger */)
@@ -385,6 +392,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
   auto base = require_singleline(stack_builder.setup_base_learner(k_value));
   void (*learn_ptr)(oaa&, VW::LEARNER::learner&, VW::example&) = nullptr;
   void (*pred_ptr)(oaa&, VW::LEARNER::learner&, VW::example&) = nullptr;
+  void (*pred_batch_ptr)(oaa&, VW::LEARNER::learner&, VW::multi_ex&) = nullptr;
   std::string name_addition;
   VW::prediction_type_t pred_type;
 
@@ -406,6 +414,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
       // the three boolean template parameters are: is_learn, print_all and scores
       learn_ptr = learn<!PRINT_ALL, SCORES, PROBABILITIES>;
       pred_ptr = predict<!PRINT_ALL, SCORES, PROBABILITIES>;
+      pred_batch_ptr = predict_batch<!PRINT_ALL, SCORES, PROBABILITIES>;
       name_addition = "-prob";
       update_stats_func = update_stats_oaa<true>;
       print_update_func = print_update_oaa<true>;
@@ -415,6 +424,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
     {
       learn_ptr = learn<!PRINT_ALL, SCORES, !PROBABILITIES>;
       pred_ptr = predict<!PRINT_ALL, SCORES, !PROBABILITIES>;
+      pred_batch_ptr = predict_batch<!PRINT_ALL, SCORES, !PROBABILITIES>;
       name_addition = "-scores";
       update_stats_func = update_stats_oaa<false>;
       print_update_func = print_update_oaa<false>;
@@ -430,12 +440,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
     {
       learn_ptr = learn<PRINT_ALL, !SCORES, !PROBABILITIES>;
       pred_ptr = predict<PRINT_ALL, !SCORES, !PROBABILITIES>;
+      pred_batch_ptr = predict_batch<PRINT_ALL, !SCORES, !PROBABILITIES>;
       name_addition = "-raw";
     }
     else
     {
       learn_ptr = learn<!PRINT_ALL, !SCORES, !PROBABILITIES>;
       pred_ptr = predict<!PRINT_ALL, !SCORES, !PROBABILITIES>;
+      pred_batch_ptr = predict_batch<!PRINT_ALL, !SCORES, !PROBABILITIES>;
       name_addition = "";
     }
   }
@@ -468,6 +480,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::oaa_setup(VW::setup_base_i
                .set_update_stats(update_stats_func)
                .set_output_example_prediction(output_example_prediction_func)
                .set_print_update(print_update_func)
+               .set_predict_batch(pred_batch_ptr)
                .build();
 
   return l;
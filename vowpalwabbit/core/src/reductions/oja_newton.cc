@@ -4,6 +4,7 @@
 #include "vw/core/reductions/oja_newton.h"
 
 #include "vw/common/random.h"
+#include "vw/common/vw_exception.h"
 #include "vw/core/learner.h"
 #include "vw/core/loss_functions.h"
 #include "vw/core/memory.h"
@@ -468,6 +469,8 @@ void learn(OjaNewton& oja_newton_ptr, VW::example& ec)
 void save_load(OjaNewton& oja_newton_ptr, VW::io_buf& model_file, bool read, bool text)
 {
   VW::workspace& all = *oja_newton_ptr.all;
+  // The sketch is initialized into the weights on load, which would overwrite mapped weights.
+  if (all.runtime_state.model_weights_external) { THROW("Memory-mappable models are not supported with --OjaNewton"); }
   if (read)
   {
     VW::details::initialize_regressor(all);
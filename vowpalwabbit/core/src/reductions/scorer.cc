@@ -28,6 +28,17 @@ public:
   VW::workspace* all;
 };  // for set_minmax, loss
 
+template <float (*link)(float in)>
+inline void set_loss_and_link(scorer& s, VW::example& ec)
+{
+  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
+  {
+    ec.loss = s.all->loss_config.loss->get_loss(s.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
+  }
+
+  ec.pred.scalar = link(ec.pred.scalar);
+}
+
 template <bool is_learn, float (*link)(float in)>
 void predict_or_learn(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
 {
@@ -38,12 +49,7 @@ void predict_or_learn(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
   if (learn) { base.learn(ec); }
   else { base.predict(ec); }
 
-  if (ec.weight > 0 && ec.l.simple.label != FLT_MAX)
-  {
-    ec.loss = s.all->loss_config.loss->get_loss(s.all->sd.get(), ec.pred.scalar, ec.l.simple.label) * ec.weight;
-  }
-
-  ec.pred.scalar = link(ec.pred.scalar);
+  set_loss_and_link<link>(s, ec);
   VW_DBG(ec) << "ex#= " << ec.example_counter << ", offset=" << ec.ft_offset << ", lbl=" << ec.l.simple.label
              << ", pred= " << ec.pred.scalar << ", wt=" << ec.weight << ", gd.raw=" << ec.partial_prediction
              << ", loss=" << ec.loss << std::endl;
@@ -57,6 +63,13 @@ inline void multipredict(scorer& /*unused*/, VW::LEARNER::learner& base, VW::exa
   for (size_t c = 0; c < count; c++) { pred[c].scalar = link(pred[c].scalar); }
 }
 
+template <float (*link)(float in)>
+void predict_batch(scorer& s, VW::LEARNER::learner& base, VW::multi_ex& examples)
+{
+  base.predict_batch(examples);
+  for (auto* ec : examples) { set_loss_and_link<link>(s, *ec); }
+}
+
 void update(scorer& s, VW::LEARNER::learner& base, VW::example& ec)
 {
   if (s.all->set_minmax) { s.all->set_minmax(ec.l.simple.label); }
@@ -94,7 +107,9 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
   using predict_or_learn_fn_t = void (*)(scorer&, VW::LEARNER::learner&, VW::example&);
   using multipredict_fn_t =
       void (*)(scorer&, VW::LEARNER::learner&, VW::example&, size_t, size_t, VW::polyprediction*, bool);
+  using predict_batch_fn_t = void (*)(scorer&, VW::LEARNER::learner&, VW::multi_ex&);
   multipredict_fn_t multipredict_f = multipredict<id>;
+  predict_batch_fn_t predict_batch_f = predict_batch<id>;
   predict_or_learn_fn_t learn_fn;
   predict_or_learn_fn_t predict_fn;
   std::string name = stack_builder.get_setupfn_name(scorer_setup);
@@ -111,6 +126,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, logistic>;
     name += "-logistic";
     multipredict_f = multipredict<logistic>;
+    predict_batch_f = predict_batch<logistic>;
   }
   else if (link == "glf1")
   {
@@ -118,6 +134,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, glf1>;
     name += "-glf1";
     multipredict_f = multipredict<glf1>;
+    predict_batch_f = predict_batch<glf1>;
   }
   else if (link == "poisson")
   {
@@ -125,6 +142,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
     predict_fn = predict_or_learn<false, expf>;
     name += "-poisson";
     multipredict_f = multipredict<expf>;
+    predict_batch_f = predict_batch<expf>;
   }
   else { THROW("Unknown link function: " << link); }
 
@@ -138,6 +156,7 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::scorer_setup(VW::setup_bas
                .set_input_prediction_type(VW::prediction_type_t::SCALAR)
                .set_output_prediction_type(VW::prediction_type_t::SCALAR)
                .set_multipredict(multipredict_f)
+               .set_predict_batch(predict_batch_f)
                .set_update(update)
                .build();
 
@@ -11,11 +11,16 @@
 #include "vw/core/learner.h"
 #include "vw/core/scope_exit.h"
 #include "vw/core/setup_base.h"
+#include "vw/core/shared_score_reduction_features.h"
 #include "vw/core/vw.h"
 
+#include <algorithm>
 #include <iterator>
 #include <string>
 #include <vector>
+
+using namespace VW::config;
+
 namespace
 {
 class sfm_metrics
@@ -30,8 +35,68 @@ public:
   std::unique_ptr<sfm_metrics> metrics;
   VW::label_type_t label_type = VW::label_type_t::CB;
   bool store_shared_ex_in_reduction_features = false;
+  // Set by --cache_shared_score.
+  std::unique_ptr<VW::shared_feature_merger::shared_score> shared_score;
 };
 
+bool has_namespace(const VW::v_array<VW::namespace_index>& indices, VW::namespace_index ns)
+{
+  return std::find(indices.begin(), indices.end(), ns) != indices.end();
+}
+
+// Copies the namespaces of the shared example which one of the actions also has into every action, like
+// append_example_namespaces_from_example. The others are left to gd through shared_score.
+void merge_shared_namespaces(
+    VW::shared_feature_merger::shared_score& shared_score, VW::example& shared_example, VW::multi_ex& ec_seq)
+{
+  shared_score.reset(&shared_example);
+  for (auto ns : shared_example.indices)
+  {
+    if (ns == VW::details::CONSTANT_NAMESPACE) { continue; }
+    if (std::none_of(
+            ec_seq.begin(), ec_seq.end(), [ns](const VW::example* action) { return has_namespace(action->indices, ns); }))
+    {
+      shared_score.namespaces.push_back(ns);
+    }
+  }
+
+  for (auto& action : ec_seq)
+  {
+    for (auto ns : shared_example.indices)
+    {
+      if (ns == VW::details::CONSTANT_NAMESPACE) { continue; }
+      const auto& fs = shared_example.feature_space[ns];
+      // The shared features are still counted, so that the number of current features is reported as usual.
+      if (has_namespace(shared_score.namespaces, ns)) { action->num_features += fs.size(); }
+      else { VW::details::append_example_namespace(*action, ns, fs); }
+    }
+  }
+}
+
+void unmerge_shared_namespaces(
+    const VW::shared_feature_merger::shared_score& shared_score, VW::example& shared_example, VW::multi_ex& ec_seq)
+{
+  for (auto& action : ec_seq)
+  {
+    for (size_t i = shared_example.indices.size(); i > 0; i--)
+    {
+      const auto ns = shared_example.indices[i - 1];
+      if (ns == VW::details::CONSTANT_NAMESPACE) { continue; }
+      const auto& fs = shared_example.feature_space[ns];
+      if (has_namespace(shared_score.namespaces, ns)) { action->num_features -= fs.size(); }
+      else { VW::details::truncate_example_namespace(*action, ns, fs); }
+    }
+  }
+}
+
+void set_shared_score(VW::multi_ex& ec_seq, VW::shared_feature_merger::shared_score* shared_score)
+{
+  for (auto& action : ec_seq)
+  {
+    action->ex_reduction_features.template get<VW::shared_feature_merger::reduction_features>().shared = shared_score;
+  }
+}
+
 template <bool is_learn, bool is_cb_with_observations>
 void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex& ec_seq)
 {
@@ -39,6 +104,8 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
 
   VW::multi_ex::value_type shared_example = nullptr;
   const bool store_shared_ex_in_reduction_features = data.store_shared_ex_in_reduction_features;
+  // Learning updates the weights of the shared features through every action, so it always copies them.
+  VW::shared_feature_merger::shared_score* shared_score = is_learn ? nullptr : data.shared_score.get();
 
   const bool has_example_header = VW::LEARNER::ec_is_example_header(*ec_seq[0], data.label_type);
 
@@ -48,19 +115,24 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
     ec_seq.erase(ec_seq.begin());
 
     // merge sequences
-    for (auto& example : ec_seq)
+    if (shared_score != nullptr) { merge_shared_namespaces(*shared_score, *shared_example, ec_seq); }
+    else
     {
-      if (is_cb_with_observations)
+      for (auto& example : ec_seq)
       {
-        if (example->l.cb_with_observations.is_observation) { continue; }
-      }
+        if (is_cb_with_observations)
+        {
+          if (example->l.cb_with_observations.is_observation) { continue; }
+        }
 
-      VW::details::append_example_namespaces_from_example(*example, *shared_example);
+        VW::details::append_example_namespaces_from_example(*example, *shared_example);
+      }
     }
 
     std::swap(ec_seq[0]->pred, shared_example->pred);
     std::swap(ec_seq[0]->tag, shared_example->tag);
     std::swap(ec_seq[0]->ex_reduction_features, shared_example->ex_reduction_features);
+    if (shared_score != nullptr && !shared_score->namespaces.empty()) { set_shared_score(ec_seq, shared_score); }
     if (store_shared_ex_in_reduction_features)
     {
       auto& red_features =
@@ -71,18 +143,26 @@ void predict_or_learn(sfm_data& data, VW::LEARNER::learner& base, VW::multi_ex&
 
   // Guard example state restore against throws
   auto restore_guard = VW::scope_exit(
-      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features]
+      [has_example_header, &shared_example, &ec_seq, &store_shared_ex_in_reduction_features, shared_score]
       {
         if (has_example_header)
         {
-          for (auto& example : ec_seq)
+          if (shared_score != nullptr)
           {
-            if (is_cb_with_observations)
+            set_shared_score(ec_seq, nullptr);
+            unmerge_shared_namespaces(*shared_score, *shared_example, ec_seq);
+          }
+          else
+          {
+            for (auto& example : ec_seq)
             {
-              if (example->l.cb_with_observations.is_observation) { continue; }
-            }
+              if (is_cb_with_observations)
+              {
+                if (example->l.cb_with_observations.is_observation) { continue; }
+              }
 
-            VW::details::truncate_example_namespaces_from_example(*example, *shared_example);
+              VW::details::truncate_example_namespaces_from_example(*example, *shared_example);
+            }
           }
           std::swap(shared_example->pred, ec_seq[0]->pred);
           std::swap(shared_example->tag, ec_seq[0]->tag);
@@ -124,6 +204,14 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::shared_feature_merger_setu
   VW::config::options_i& options = *stack_builder.get_options();
   VW::workspace& all = *stack_builder.get_all_pointer();
 
+  bool cache_shared_score = false;
+  option_group_definition new_options("[Reduction] Shared Feature Merger");
+  new_options.add(make_option("cache_shared_score", cache_shared_score)
+                      .help("When predicting, compute the linear score of shared features once per example instead of "
+                            "once per action, and do not copy shared namespaces which no action has into the actions")
+                      .experimental());
+  options.add_and_parse(new_options);
+
   auto base = stack_builder.setup_base_learner();
   if (base == nullptr) { return nullptr; }
   std::set<label_type_t> sfm_labels = {label_type_t::CB, label_type_t::CS, label_type_t::CB_WITH_OBSERVATIONS};
@@ -132,6 +220,32 @@ std::shared_ptr<VW::LEARNER::learner> VW::reductions::shared_feature_merger_setu
   auto data = VW::make_unique<sfm_data>();
   if (all.output_runtime.global_metrics.are_metrics_enabled()) { data->metrics = VW::make_unique<sfm_metrics>(); }
   if (options.was_supplied("large_action_space")) { data->store_shared_ex_in_reduction_features = true; }
+  if (cache_shared_score)
+  {
+    if (all.output_config.audit || all.output_config.hash_inv)
+    {
+      THROW("--cache_shared_score cannot be used with --audit or --invert_hash");
+    }
+    if (!all.feature_tweaks_config.extent_interactions.empty())
+    {
+      THROW("--cache_shared_score cannot be used with full name interactions");
+    }
+    // gd scores the shared namespaces, so every reduction in between must predict from the features gd sees.
+    const std::vector<std::string> compatible_learners = {"gd", "generate_interactions", "scorer", "csoaa_ldf",
+        "cb_adf", "cb_explore_adf_greedy", "cb_explore_adf_softmax", "cb_explore_adf_first", "cb_explore_adf_bag",
+        "cb_sample", "cb_actions_mask"};
+    std::vector<std::string> enabled_learners;
+    base->get_enabled_learners(enabled_learners);
+    for (const auto& name : enabled_learners)
+    {
+      if (std::find(compatible_learners.begin(), compatible_learners.end(), name.substr(0, name.find('-'))) ==
+          compatible_learners.end())
+      {
+        THROW("--cache_shared_score cannot be used with " << name);
+      }
+    }
+    data->shared_score = VW::make_unique<VW::shared_feature_merger::shared_score>();
+  }
 
   auto multi_base = VW::LEARNER::require_multiline(base);
   data->label_type = base->get_input_label_type();
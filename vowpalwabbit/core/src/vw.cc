@@ -464,7 +464,12 @@ void VW::free_args(int argc, char* argv[])
 
 const char* VW::are_features_compatible(const VW::workspace& vw1, const VW::workspace& vw2)
 {
-  if (vw1.parser_runtime.example_parser->hasher != vw2.parser_runtime.example_parser->hasher) { return "hasher"; }
+  // Caching does not change the hashes.
+  if (vw1.parser_runtime.example_parser->hasher.get_hash_function() !=
+      vw2.parser_runtime.example_parser->hasher.get_hash_function())
+  {
+    return "hasher";
+  }
 
   if (!std::equal(vw1.feature_tweaks_config.spelling_features.begin(),
           vw1.feature_tweaks_config.spelling_features.end(), vw2.feature_tweaks_config.spelling_features.begin()))
@@ -602,9 +607,16 @@ namespace
 
 void thread_dispatch(VW::workspace& all, const VW::multi_ex& examples)
 {
-  for (auto* example : examples) { all.parser_runtime.example_parser->ready_parsed_examples.push(example); }
+  all.parser_runtime.example_parser->ready_parsed_examples.push_batch(examples.begin(), examples.end());
+}
+void main_parse_loop(VW::workspace* all)
+{
+  if (all->parser_runtime.example_parser->parse_threads > 1)
+  {
+    VW::details::parallel_parse_dispatch(*all, thread_dispatch);
+  }
+  else { VW::details::parse_dispatch(*all, thread_dispatch); }
 }
-void main_parse_loop(VW::workspace* all) { VW::details::parse_dispatch(*all, thread_dispatch); }
 }  // namespace
 
 void VW::start_parser(VW::workspace& all) { all.parser_runtime.parse_thread = std::thread(main_parse_loop, &all); }
@@ -713,9 +725,17 @@ void VW::setup_example(VW::workspace& all, VW::example* ae)
 
   if (all.parser_runtime.example_parser->write_cache)
   {
-    VW::parsers::cache::write_example_to_cache(all.parser_runtime.example_parser->output, ae,
-        all.parser_runtime.example_parser->lbl_parser, all.runtime_state.parse_mask,
-        all.parser_runtime.example_parser->cache_temp_buffer_obj);
+    if (all.parser_runtime.example_parser->block_cache_writer != nullptr)
+    {
+      all.parser_runtime.example_parser->block_cache_writer->write_example(all.parser_runtime.example_parser->output,
+          *ae, all.parser_runtime.example_parser->lbl_parser, all.runtime_state.parse_mask);
+    }
+    else
+    {
+      VW::parsers::cache::write_example_to_cache(all.parser_runtime.example_parser->output, ae,
+          all.parser_runtime.example_parser->lbl_parser, all.runtime_state.parse_mask,
+          all.parser_runtime.example_parser->cache_temp_buffer_obj);
+    }
   }
 
   // Require all extents to be complete in an VW::example.
@@ -0,0 +1,93 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/accumulate.h"
+
+#include "vw/allreduce/allreduce.h"
+#include "vw/core/global_data.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t NUM_WEIGHTS = 1 << 12;
+
+class two_node_cluster
+{
+public:
+  explicit two_node_cluster(const std::string& compression)
+  {
+    for (auto& node : nodes)
+    {
+      node = VW::initialize(vwtest::make_args("--quiet", "-b", "12", "--all_reduce_compression", compression));
+      node->runtime_config.selected_all_reduce_type = VW::all_reduce_type::THREAD;
+    }
+    nodes[0]->runtime_state.all_reduce.reset(new VW::all_reduce_threads(2, 0));
+    auto* root = dynamic_cast<VW::all_reduce_threads*>(nodes[0]->runtime_state.all_reduce.get());
+    nodes[1]->runtime_state.all_reduce.reset(new VW::all_reduce_threads(root, 2, 1));
+  }
+
+  void accumulate_avg()
+  {
+    std::thread other([this]() { VW::details::accumulate_avg(*nodes[1], nodes[1]->weights, 0); });
+    VW::details::accumulate_avg(*nodes[0], nodes[0]->weights, 0);
+    other.join();
+  }
+
+  float& weight(size_t node, uint64_t index) { return nodes[node]->weights.dense_weights.strided_index(index); }
+
+  std::unique_ptr<VW::workspace> nodes[2];
+};
+
+void check_accumulate_avg(const std::string& compression, float tolerance)
+{
+  two_node_cluster cluster(compression);
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i += 7) { cluster.weight(0, i) = 0.001f * i; }
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i += 11) { cluster.weight(1, i) = 0.5f; }
+  cluster.accumulate_avg();
+
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i++)
+  {
+    const float expected = ((i % 7 == 0 ? 0.001f * i : 0.f) + (i % 11 == 0 ? 0.5f : 0.f)) / 2.f;
+    EXPECT_NEAR(cluster.weight(0, i), expected, tolerance) << compression << " index " << i;
+    EXPECT_EQ(cluster.weight(0, i), cluster.weight(1, i)) << compression << " index " << i;
+  }
+
+  // Only one weight changes on one node, every other weight must come back exactly as it was.
+  std::vector<float> before(NUM_WEIGHTS);
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i++) { before[i] = cluster.weight(0, i); }
+  cluster.weight(1, 100) += 1.f;
+  cluster.accumulate_avg();
+
+  for (uint64_t i = 0; i < NUM_WEIGHTS; i++)
+  {
+    if (i == 100) { EXPECT_NEAR(cluster.weight(0, i), before[i] + 0.5f, tolerance) << compression; }
+    else if (i < VW::details::COMPRESSED_ALL_REDUCE_BLOCK_SIZE)
+    {
+      // The changed block also carries what was lost by the first sync.
+      EXPECT_NEAR(cluster.weight(0, i), before[i], tolerance) << compression << " index " << i;
+    }
+    else { EXPECT_EQ(cluster.weight(0, i), before[i]) << compression << " index " << i; }
+    EXPECT_EQ(cluster.weight(0, i), cluster.weight(1, i)) << compression << " index " << i;
+  }
+}
+}  // namespace
+
+TEST(Accumulate, SparseAllReduceIsExact) { check_accumulate_avg("sparse", 1e-6f); }
+
+TEST(Accumulate, Fp16AllReduceIsClose) { check_accumulate_avg("fp16", 5e-3f); }
+
+TEST(Accumulate, Int8AllReduceIsClose) { check_accumulate_avg("int8", 5e-2f); }
+
+TEST(Accumulate, UnknownCompressionThrows)
+{
+  EXPECT_THROW(VW::details::all_reduce_compression_from_string("gzip"), VW::vw_exception);
+}
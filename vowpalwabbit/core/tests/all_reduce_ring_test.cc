@@ -0,0 +1,80 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/allreduce/allreduce.h"
+#include "vw/io/logger.h"
+#include "vw/spanning_tree/spanning_tree.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <vector>
+
+namespace
+{
+void add_float(float& a, const float& b) { a += b; }
+
+float node_value(size_t node, size_t i) { return static_cast<float>((node + 1) * (i % 7)); }
+
+// Runs one all_reduce of n floats on each of total nodes connected through a local spanning tree server.
+std::vector<std::vector<float>> ring_all_reduce_on_localhost(size_t total, size_t n, size_t reductions)
+{
+  VW::spanning_tree server(0, true);
+  server.start();
+
+  std::vector<std::future<std::vector<float>>> nodes;
+  for (size_t node = 0; node < total; node++)
+  {
+    nodes.push_back(std::async(std::launch::async,
+        [&server, total, n, reductions, node]()
+        {
+          auto logger = VW::io::create_null_logger();
+          VW::all_reduce_ring_sockets all_reduce("localhost", server.bound_port(), 1, total, node, true);
+          std::vector<float> buffer(n);
+          for (size_t r = 0; r < reductions; r++)
+          {
+            for (size_t i = 0; i < n; i++) { buffer[i] = node_value(node, i); }
+            all_reduce.all_reduce<float, add_float>(buffer.data(), n, logger);
+          }
+          return buffer;
+        }));
+  }
+
+  std::vector<std::vector<float>> results;
+  for (auto& node : nodes) { results.push_back(node.get()); }
+  // The server is stopped by its destructor, stopping it twice waits on a consumed future.
+  return results;
+}
+
+void check_sums(const std::vector<std::vector<float>>& results, size_t total, size_t n)
+{
+  ASSERT_EQ(results.size(), total);
+  for (const auto& buffer : results)
+  {
+    ASSERT_EQ(buffer.size(), n);
+    for (size_t i = 0; i < n; i++)
+    {
+      float expected = 0.f;
+      for (size_t node = 0; node < total; node++) { expected += node_value(node, i); }
+      ASSERT_EQ(buffer[i], expected) << "at index " << i;
+    }
+  }
+}
+}  // namespace
+
+TEST(AllReduceRing, SumsLargeBufferAcrossLocalNodes)
+{
+  // Segments do not divide evenly and are streamed in several AR_BUF_SIZE chunks.
+  const size_t total = 3;
+  const size_t n = 3 * VW::details::AR_BUF_SIZE + 1;
+  check_sums(ring_all_reduce_on_localhost(total, n, 2), total, n);
+}
+
+TEST(AllReduceRing, SmallBufferFallsBackToTree)
+{
+  const size_t total = 4;
+  const size_t n = 10;
+  check_sums(ring_all_reduce_on_localhost(total, n, 1), total, n);
+}
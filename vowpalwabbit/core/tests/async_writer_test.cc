@@ -0,0 +1,55 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/async_writer.h"
+
+#include "vw/common/vw_exception.h"
+#include "vw/io/io_adapter.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+class failing_writer : public VW::io::writer
+{
+public:
+  ssize_t write(const char*, size_t) override { return -1; }
+};
+}  // namespace
+
+TEST(AsyncWriter, AsyncWriterWritesInOrder)
+{
+  auto output = std::make_shared<std::vector<char>>();
+  std::string expected;
+  {
+    VW::details::async_writer writer(VW::io::create_vector_writer(output), 16, 2, std::chrono::milliseconds(0));
+    for (int i = 0; i < 1000; i++)
+    {
+      const std::string line = std::to_string(i) + "\n";
+      EXPECT_EQ(writer.write(line.data(), line.size()), static_cast<ssize_t>(line.size()));
+      expected += line;
+      if (i == 500)
+      {
+        writer.flush();
+        EXPECT_EQ(std::string(output->begin(), output->end()), expected);
+      }
+    }
+  }
+  EXPECT_EQ(std::string(output->begin(), output->end()), expected);
+}
+
+TEST(AsyncWriter, AsyncWriterRethrowsErrors)
+{
+  VW::details::async_writer writer(
+      std::unique_ptr<VW::io::writer>(new failing_writer()), 4, 1, std::chrono::milliseconds(0));
+  writer.write("abcdef", 6);
+  EXPECT_THROW(writer.flush(), VW::vw_exception);
+  EXPECT_THROW(writer.write("a", 1), VW::vw_exception);
+}
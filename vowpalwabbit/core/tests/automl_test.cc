@@ -5,6 +5,7 @@
 #include "vw/core/reductions/automl.h"
 
 #include "simulator.h"
+#include "vw/common/vw_exception.h"
 #include "vw/core/automl_impl.h"
 #include "vw/core/estimators/confidence_sequence_robust.h"
 #include "vw/core/interactions.h"
@@ -15,7 +16,9 @@
 
 #include <functional>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 using simulator::callback_map;
 using simulator::cb_sim;
@@ -464,6 +467,24 @@ TEST(Automl, QColConsistencyWIterations)
   EXPECT_FLOAT_EQ(ctr_q_col.back(), ctr_aml.back());
 }
 
+TEST(Automl, LearnThreadsMatchSerialLearningWIterations)
+{
+  const size_t seed = 88;
+  const size_t num_iterations = 1000;
+  // A fixed label range, since challengers learned on other threads only see the range of earlier examples.
+  std::vector<std::string> args = {"--cb_explore_adf", "--quiet", "--epsilon", "0.2", "--random_seed", "5", "--automl",
+      "4", "--default_lease", "10", "--min_prediction", "-1", "--max_prediction", "1"};
+
+  auto ctr_serial = simulator::_test_helper(args, num_iterations, seed);
+  args.insert(args.end(), {"--automl_threads", "2"});
+  auto ctr_threads = simulator::_test_helper(args, num_iterations, seed);
+
+  EXPECT_EQ(ctr_serial, ctr_threads);
+
+  args.insert(args.end(), {"--l2", "0.001"});
+  EXPECT_THROW(simulator::_test_helper(args, 10, seed), VW::vw_exception);
+}
+
 TEST(Automl, OneDiffImplUnittestWIterations)
 {
   using namespace VW::reductions::automl;
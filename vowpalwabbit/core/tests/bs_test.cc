@@ -0,0 +1,69 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/config/options_cli.h"
+#include "vw/core/memory.h"
+#include "vw/core/vw.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Every thread starts an example from the label range of the learning thread, so the range is fixed.
+// replace_weights swaps the weights for a copy halfway, as a daemon does when it reloads its model, and adds the final
+// weights to the predictions, since every model is learned by the same thread and would see its own updates anyway.
+std::vector<float> bootstrap_predictions(std::vector<std::string> args, bool replace_weights = false)
+{
+  args.insert(args.end(), {"--quiet", "--min_prediction", "-1", "--max_prediction", "1"});
+  auto vw = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+  const std::vector<std::string> lines = {"1 |f a b", "0.5 1 0.2 |f a c:2", "-1 |f b c", "0.3 |f d", "-0.4 2 |f a d"};
+  std::vector<float> predictions;
+  for (int pass = 0; pass < 20; pass++)
+  {
+    if (replace_weights && pass == 10)
+    {
+      vw->weights.dense_weights = VW::dense_parameters::deep_copy(vw->weights.dense_weights);
+    }
+    for (const auto& line : lines)
+    {
+      auto& ex = *VW::read_example(*vw, line);
+      vw->learn(ex);
+      predictions.push_back(ex.pred.scalar);
+      vw->finish_example(ex);
+    }
+  }
+  for (const auto& line : lines)
+  {
+    auto& ex = *VW::read_example(*vw, line);
+    vw->predict(ex);
+    predictions.push_back(ex.pred.scalar);
+    predictions.push_back(ex.partial_prediction);
+    vw->finish_example(ex);
+  }
+  if (replace_weights)
+  {
+    const auto& weights = vw->weights.dense_weights;
+    predictions.insert(predictions.end(), weights.data(), weights.data() + weights.mask() + 1);
+  }
+  return predictions;
+}
+}  // namespace
+
+TEST(Bootstrap, EnsembleThreadsMatchSerialLearning)
+{
+  EXPECT_EQ(bootstrap_predictions({"--bootstrap", "4", "--random_seed", "3"}),
+      bootstrap_predictions({"--bootstrap", "4", "--random_seed", "3", "--ensemble_threads", "3"}));
+  EXPECT_EQ(bootstrap_predictions({"--bootstrap", "3", "--bs_type", "vote"}),
+      bootstrap_predictions({"--bootstrap", "3", "--bs_type", "vote", "--ensemble_threads", "2"}));
+}
+
+TEST(Bootstrap, EnsembleThreadsFollowReplacedWeights)
+{
+  EXPECT_EQ(bootstrap_predictions({"--bootstrap", "4", "--random_seed", "3", "-b", "6"}, true),
+      bootstrap_predictions({"--bootstrap", "4", "--random_seed", "3", "-b", "6", "--ensemble_threads", "3"}, true));
+}
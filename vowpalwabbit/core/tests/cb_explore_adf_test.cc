@@ -2,12 +2,19 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "simulator.h"
+#include "vw/config/options_cli.h"
+#include "vw/core/memory.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 TEST(CbExploreAdf, ShouldThrowEmptyMultiExample)
 {
   auto vw = VW::initialize(vwtest::make_args("--cb_explore_adf", "--quiet"));
@@ -16,3 +23,190 @@ TEST(CbExploreAdf, ShouldThrowEmptyMultiExample)
   // An empty example collection is invalid and so should throw.
   EXPECT_THROW(vw->learn(example_collection), VW::vw_exception);
 }
+
+TEST(CbExploreAdf, CacheSharedScoreMatchesMergedPredictions)
+{
+  // User is only used by an interaction with the actions and Time only by an interaction with itself. Both are left
+  // out of the actions by --cache_shared_score, while Other, which the actions also have, is still copied.
+  const std::vector<std::vector<std::string>> training = {
+      {"shared |User a b:2 |Time t1 |Other o", "0:1.0:0.5 |Action x y |Other p", "|Action z |Other q"},
+      {"shared |User c |Time t2 t3 |Other o", "|Action x |Other p", "1:-1.0:0.5 |Action y z"},
+      {"shared |User a c:0.5 |Time t1 |Other r", "|Action z", "0:0.5:0.5 |Action x |Other q"}};
+  const std::vector<std::string> test = {"shared |User b c |Time t3 |Other o", "|Action x y |Other p", "|Action z",
+      "|Action y |Other q r"};
+
+  // bag predicts each action with several offsets.
+  const std::vector<std::vector<std::string>> reductions = {
+      {"--cb_adf"}, {"--cb_explore_adf", "--softmax", "--lambda", "1"}, {"--cb_explore_adf", "--bag", "3"}};
+  for (const auto& reduction : reductions)
+  {
+    std::vector<std::string> args = reduction;
+    args.insert(args.end(), {"-q", "UA", "-q", "TT", "--quiet"});
+    auto merged = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    args.push_back("--cache_shared_score");
+    auto cached = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+    for (auto* vw : {merged.get(), cached.get()})
+    {
+      for (int pass = 0; pass < 5; pass++)
+      {
+        for (const auto& lines : training)
+        {
+          VW::multi_ex examples;
+          for (const auto& line : lines) { examples.push_back(VW::read_example(*vw, line)); }
+          vw->learn(examples);
+          vw->finish_example(examples);
+        }
+      }
+    }
+
+    VW::multi_ex merged_examples;
+    VW::multi_ex cached_examples;
+    for (const auto& line : test)
+    {
+      merged_examples.push_back(VW::read_example(*merged, line));
+      cached_examples.push_back(VW::read_example(*cached, line));
+    }
+    merged->predict(merged_examples);
+    cached->predict(cached_examples);
+
+    const auto& merged_scores = merged_examples[0]->pred.a_s;
+    const auto& cached_scores = cached_examples[0]->pred.a_s;
+    ASSERT_EQ(merged_scores.size(), cached_scores.size());
+    for (size_t i = 0; i < merged_scores.size(); i++)
+    {
+      EXPECT_EQ(merged_scores[i].action, cached_scores[i].action);
+      EXPECT_NEAR(merged_scores[i].score, cached_scores[i].score, 1e-5f);
+    }
+    // The actions are left as they were.
+    for (size_t i = 0; i < test.size(); i++)
+    {
+      EXPECT_THAT(merged_examples[i]->indices, testing::ElementsAreArray(cached_examples[i]->indices));
+      EXPECT_EQ(merged_examples[i]->num_features, cached_examples[i]->num_features);
+    }
+
+    merged->finish_example(merged_examples);
+    cached->finish_example(cached_examples);
+  }
+}
+
+TEST(CbExploreAdf, CacheSharedScoreRejectsIncompatibleReductions)
+{
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--cb_explore_adf", "--regcb", "--cache_shared_score", "--quiet")),
+      VW::vw_exception);
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--cb_explore_adf", "--cache_shared_score", "--audit", "--quiet")),
+      VW::vw_exception);
+}
+
+TEST(CbExploreAdf, EnsembleThreadsMatchSerialLearningWIterations)
+{
+  // Every thread starts an example from the label range of the learning thread, so the range is fixed.
+  const std::vector<std::vector<std::string>> explorations = {
+      {"--bag", "4"}, {"--bag", "3", "--greedify"}, {"--cover", "4"}, {"--bag", "4", "--cache_shared_score"}};
+  for (const auto& exploration : explorations)
+  {
+    std::vector<std::string> args = {
+        "--cb_explore_adf", "--quiet", "--random_seed", "5", "--min_prediction", "-1", "--max_prediction", "1"};
+    args.insert(args.end(), exploration.begin(), exploration.end());
+    const auto serial_ctr = simulator::_test_helper(args, 500, 10);
+    args.insert(args.end(), {"--ensemble_threads", "2"});
+    EXPECT_EQ(simulator::_test_helper(args, 500, 10), serial_ctr);
+  }
+}
+
+TEST(CbExploreAdf, ActionShortlistPredictsShortlistedActions)
+{
+  const std::vector<std::vector<std::string>> training = {
+      {"shared |User a b", "0:1.0:0.5 |Action x", "|Action y", "|Action z w", "|Action v", "|Action u x", "|Action t"},
+      {"shared |User c", "|Action x", "1:-1.0:0.5 |Action y", "|Action z w", "|Action v", "|Action u x", "|Action t"},
+      {"shared |User a c", "|Action x", "|Action y", "|Action z w", "0:0.5:0.5 |Action v", "|Action u x", "|Action t"},
+      {"shared |User b", "|Action x", "|Action y", "|Action z w", "|Action v", "|Action u x", "0:-0.5:0.5 |Action t"}};
+  const std::vector<std::string> test = {
+      "shared |User b c", "|Action x", "|Action y", "|Action z w", "|Action v", "|Action u x", "|Action t"};
+
+  for (const bool interactions : {false, true})
+  {
+    std::vector<std::string> args = {"--cb_adf", "--quiet"};
+    if (interactions) { args.insert(args.end(), {"-q", "UA"}); }
+    auto full = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+    args.insert(args.end(), {"--action_shortlist", "3"});
+    auto shortlist = VW::initialize(VW::make_unique<VW::config::options_cli>(args));
+
+    for (auto* vw : {full.get(), shortlist.get()})
+    {
+      for (int pass = 0; pass < 5; pass++)
+      {
+        for (const auto& lines : training)
+        {
+          VW::multi_ex examples;
+          for (const auto& line : lines) { examples.push_back(VW::read_example(*vw, line)); }
+          vw->learn(examples);
+          vw->finish_example(examples);
+        }
+      }
+    }
+
+    VW::multi_ex full_examples;
+    VW::multi_ex shortlist_examples;
+    for (const auto& line : test)
+    {
+      full_examples.push_back(VW::read_example(*full, line));
+      shortlist_examples.push_back(VW::read_example(*shortlist, line));
+    }
+    full->predict(full_examples);
+    shortlist->predict(shortlist_examples);
+
+    // Only the shortlisted actions are ranked, and they have the scores they have without the shortlist.
+    const auto& full_scores = full_examples[0]->pred.a_s;
+    const auto& shortlist_scores = shortlist_examples[0]->pred.a_s;
+    ASSERT_EQ(shortlist_scores.size(), 3);
+    for (size_t i = 0; i < 3; i++)
+    {
+      const auto full_score = std::find_if(full_scores.begin(), full_scores.end(),
+          [&](const VW::action_score& a) { return a.action == shortlist_scores[i].action; });
+      ASSERT_NE(full_score, full_scores.end());
+      EXPECT_FLOAT_EQ(shortlist_scores[i].score, full_score->score);
+      // Without interactions, the shortlist is ranked by the full score.
+      if (!interactions) { EXPECT_EQ(shortlist_scores[i].action, full_scores[i].action); }
+    }
+
+    full->finish_example(full_examples);
+    shortlist->finish_example(shortlist_examples);
+  }
+}
+
+TEST(CbExploreAdf, ActionShortlistGivesNoProbabilityToOtherActions)
+{
+  auto vw = VW::initialize(
+      vwtest::make_args("--cb_explore_adf", "--epsilon", "0.3", "--action_shortlist", "2", "-q", "UA", "--quiet"));
+  const std::vector<std::string> test = {"shared |User a", "|Action x", "|Action y", "|Action z", "|Action w"};
+
+  VW::multi_ex examples;
+  for (const auto& line : test) { examples.push_back(VW::read_example(*vw, line)); }
+  vw->predict(examples);
+
+  // Every action is returned, but only the shortlisted ones are explored.
+  std::vector<uint32_t> actions;
+  size_t explored = 0;
+  float total = 0.f;
+  for (const auto& action_prob : examples[0]->pred.a_s)
+  {
+    actions.push_back(action_prob.action);
+    if (action_prob.score > 0.f) { explored++; }
+    total += action_prob.score;
+  }
+  EXPECT_THAT(actions, testing::UnorderedElementsAre(0, 1, 2, 3));
+  EXPECT_EQ(explored, 2);
+  EXPECT_FLOAT_EQ(total, 1.f);
+  vw->finish_example(examples);
+}
+
+TEST(CbExploreAdf, ActionShortlistRejectsExplorationOverEveryAction)
+{
+  EXPECT_THROW(
+      VW::initialize(vwtest::make_args("--cb_explore_adf", "--bag", "3", "--action_shortlist", "2", "--quiet")),
+      VW::vw_exception);
+  EXPECT_THROW(VW::initialize(vwtest::make_args(
+                   "--cb_explore_adf", "--large_action_space", "--action_shortlist", "2", "--quiet")),
+      VW::vw_exception);
+}
@@ -0,0 +1,447 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/daemon_server.h"
+
+#include "vw/cache_parser/parse_example_cache.h"
+#include "vw/core/global_data.h"
+#include "vw/core/parser.h"
+#include "vw/core/scope_exit.h"
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+#include "vw/text_parser/parse_example_text.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <sys/time.h>
+#  include <unistd.h>
+
+#  include <algorithm>
+#  include <atomic>
+#  include <chrono>
+#  include <cmath>
+#  include <csignal>
+#  include <cstdio>
+#  include <cstring>
+#  include <fstream>
+#  include <memory>
+#  include <string>
+#  include <thread>
+#  include <vector>
+
+namespace
+{
+// Runs run_threaded_daemon for a workspace on an ephemeral port until stopped.
+class daemon_under_test
+{
+public:
+  explicit daemon_under_test(std::vector<std::string> args, size_t threads = 2)
+  {
+    args.insert(args.end(),
+        {"--quiet", "--daemon", "--foreground", "--daemon_threads", std::to_string(threads), "--port", "0"});
+    vw = VW::initialize(vwtest::make_args(args));
+    sockaddr_in address;
+    socklen_t size = sizeof(address);
+    getsockname(vw->parser_runtime.example_parser->bound_sock, reinterpret_cast<sockaddr*>(&address), &size);
+    port = ntohs(address.sin_port);
+    // Until the daemon installs its handlers, SIGTERM must not end the test.
+    signal(SIGTERM, [](int) {});
+    server = std::thread(
+        [this]()
+        {
+          VW::details::run_threaded_daemon(*vw);
+          stopped = true;
+        });
+  }
+
+  ~daemon_under_test()
+  {
+    while (!stopped)
+    {
+      raise(SIGTERM);
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    server.join();
+  }
+
+  std::unique_ptr<VW::workspace> vw;
+  uint16_t port = 0;
+  std::atomic<bool> stopped{false};
+  std::thread server;
+};
+
+class client
+{
+public:
+  explicit client(uint16_t port, int receive_buffer_size = 0) : fd(socket(AF_INET, SOCK_STREAM, 0))
+  {
+    timeval timeout = {30, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    if (receive_buffer_size > 0)
+    {
+      setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receive_buffer_size, sizeof(receive_buffer_size));
+    }
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    EXPECT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+  }
+  ~client() { close(fd); }
+
+  // Returns false if the daemon closed the connection before all of data was sent.
+  bool send_data(const std::string& data)
+  {
+    size_t sent = 0;
+    while (sent < data.size())
+    {
+      const auto write_size = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (write_size <= 0) { return false; }
+      sent += static_cast<size_t>(write_size);
+    }
+    return true;
+  }
+
+  // Sends data until the daemon stops taking it for a second. Returns the number of bytes sent.
+  size_t send_until_blocked(const std::string& data)
+  {
+    size_t sent = 0;
+    auto last_progress = std::chrono::steady_clock::now();
+    while (sent < data.size() && std::chrono::steady_clock::now() - last_progress < std::chrono::seconds(1))
+    {
+      const auto write_size = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+      if (write_size > 0)
+      {
+        sent += static_cast<size_t>(write_size);
+        last_progress = std::chrono::steady_clock::now();
+      }
+      else { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+    }
+    return sent;
+  }
+
+  // Returns the response up to and including terminator, or what was received if the connection is closed first.
+  std::string receive_until(const std::string& terminator)
+  {
+    size_t end = std::string::npos;
+    while ((end = _received.find(terminator)) == std::string::npos && fill()) {}
+    return take(end == std::string::npos ? _received.size() : end + terminator.size());
+  }
+
+  std::string receive_bytes(size_t count)
+  {
+    while (_received.size() < count && fill()) {}
+    return take(std::min(count, _received.size()));
+  }
+
+  bool closed_by_daemon()
+  {
+    while (fill()) {}
+    return errno == 0 || errno == ECONNRESET;
+  }
+
+private:
+  int fd;
+  std::string _received;
+
+  // Returns false once the connection is closed, with errno 0 if it was closed in an orderly way.
+  bool fill()
+  {
+    char buffer[4096];
+    const auto read_size = recv(fd, buffer, sizeof(buffer), 0);
+    if (read_size == 0) { errno = 0; }
+    if (read_size <= 0) { return false; }
+    _received.append(buffer, static_cast<size_t>(read_size));
+    return true;
+  }
+
+  std::string take(size_t count)
+  {
+    auto result = _received.substr(0, count);
+    _received.erase(0, count);
+    return result;
+  }
+};
+
+std::vector<VW::example*> parse_examples(VW::workspace& vw, const std::vector<std::string>& lines)
+{
+  std::vector<VW::example*> examples;
+  for (const auto& line : lines)
+  {
+    auto& ex = VW::get_unused_example(&vw);
+    VW::parsers::text::read_line(vw, &ex, line.c_str());
+    examples.push_back(&ex);
+  }
+  return examples;
+}
+
+float predict(VW::workspace& vw, const std::string& line)
+{
+  auto& ex = *parse_examples(vw, {line})[0];
+  VW::setup_example(vw, &ex);
+  vw.predict(ex);
+  const float prediction = ex.pred.scalar;
+  vw.finish_example(ex);
+  return prediction;
+}
+
+// Encodes lines the way binary daemon clients send them. An empty line becomes a newline example.
+std::string to_binary(VW::workspace& vw, const std::vector<std::string>& lines)
+{
+  auto buffer = std::make_shared<std::vector<char>>();
+  VW::io_buf output;
+  output.add_file(VW::io::create_vector_writer(buffer));
+  VW::parsers::cache::details::cache_temp_buffer temp_buffer;
+  for (auto* ex : parse_examples(vw, lines))
+  {
+    VW::parsers::cache::write_example_to_cache(
+        output, ex, vw.parser_runtime.example_parser->lbl_parser, vw.runtime_state.parse_mask, temp_buffer);
+    VW::finish_example(vw, *ex);
+  }
+  output.flush();
+  return std::string(buffer->begin(), buffer->end());
+}
+
+void save_model(const std::vector<std::string>& args, const std::vector<std::string>& train_data,
+    const std::string& file, bool multiline)
+{
+  auto vw = VW::initialize(vwtest::make_args(args));
+  VW::multi_ex group;
+  for (auto* ex : parse_examples(*vw, train_data))
+  {
+    if (!multiline)
+    {
+      VW::setup_example(*vw, ex);
+      vw->learn(*ex);
+      vw->finish_example(*ex);
+    }
+    else if (!ex->is_newline) { group.push_back(ex); }
+    else
+    {
+      VW::finish_example(*vw, *ex);
+      VW::setup_examples(*vw, group);
+      vw->learn(group);
+      vw->finish_example(group);
+      group.clear();
+    }
+  }
+  VW::save_predictor(*vw, file);
+}
+
+// A single line with more features than the daemon reads in one turn.
+std::string long_line()
+{
+  std::string line = "|a";
+  for (size_t i = 0; line.size() < (3 << 20); i++) { line += " f" + std::to_string(i); }
+  return line;
+}
+
+size_t count_actions(const std::string& prediction)
+{
+  return prediction.empty() ? 0 : static_cast<size_t>(std::count(prediction.begin(), prediction.end(), ',')) + 1;
+}
+}  // namespace
+
+TEST(DaemonServer, ServesTextAndBinaryAndReloads)
+{
+  const std::string model = "daemon_server_test.model";
+  const std::string model_a = "daemon_server_test_a.model";
+  const std::string model_b = "daemon_server_test_b.model";
+  auto remove_models = VW::scope_exit(
+      [&]()
+      {
+        std::remove(model.c_str());
+        std::remove(model_a.c_str());
+        std::remove(model_b.c_str());
+      });
+  save_model({"--quiet", "--no_stdin"}, {"1 |a x y", "0.5 |a w", "1 |a x"}, model_a, false);
+  save_model({"--quiet", "--no_stdin"}, {"-1 |a x y", "-0.5 |a w", "-1 |a x"}, model_b, false);
+  std::rename(model_a.c_str(), model.c_str());
+
+  auto local = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-t", "-i", model));
+  auto reloaded = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-t", "-i", model_b));
+  const std::string line = long_line();
+  const float expected_x = predict(*local, "|a x y");
+  const float expected_w = predict(*local, "|a w");
+  const float expected_long = predict(*local, line);
+  const float expected_reloaded = predict(*reloaded, "|a x y");
+  ASSERT_GT(expected_x, 0.f);
+  ASSERT_LT(expected_reloaded, 0.f);
+
+  daemon_under_test daemon({"-t", "-i", model});
+
+  // Text, with a line split across several sends.
+  client text(daemon.port);
+  ASSERT_TRUE(text.send_data("|a x y\n|a"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_TRUE(text.send_data(" w\n"));
+  EXPECT_NEAR(std::stof(text.receive_until("\n")), expected_x, 1e-5);
+  EXPECT_NEAR(std::stof(text.receive_until("\n")), expected_w, 1e-5);
+
+  // A line longer than the input the daemon reads in one turn.
+  ASSERT_TRUE(text.send_data(line + "\n"));
+  EXPECT_NEAR(std::stof(text.receive_until("\n")), expected_long, 1e-4);
+
+  // Binary, with the prediction and weight of each example as two floats.
+  client binary(daemon.port);
+  ASSERT_TRUE(binary.send_data(std::string(1, '\0') + to_binary(*local, {"|a x y", "|a w"})));
+  const auto binary_response = binary.receive_bytes(4 * sizeof(float));
+  ASSERT_EQ(binary_response.size(), 4 * sizeof(float));
+  float binary_predictions[4];
+  std::memcpy(binary_predictions, binary_response.data(), sizeof(binary_predictions));
+  EXPECT_NEAR(binary_predictions[0], expected_x, 1e-5);
+  EXPECT_NEAR(binary_predictions[2], expected_w, 1e-5);
+
+  // Input without the end of an example closes the connection once it is over the limit.
+  {
+    client oversize(daemon.port);
+    oversize.send_data(std::string(17 << 20, 'a'));
+    EXPECT_TRUE(oversize.closed_by_daemon());
+  }
+
+  // Connections are still served while the model is reloaded, and get the new model once it is loaded.
+  std::rename(model_b.c_str(), model.c_str());
+  raise(SIGHUP);
+  float prediction = expected_x;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (std::abs(prediction - expected_reloaded) > 1e-5 && std::chrono::steady_clock::now() < deadline)
+  {
+    ASSERT_TRUE(text.send_data("|a x y\n"));
+    prediction = std::stof(text.receive_until("\n"));
+    EXPECT_TRUE(std::abs(prediction - expected_x) < 1e-5 || std::abs(prediction - expected_reloaded) < 1e-5)
+        << prediction;
+  }
+  EXPECT_NEAR(prediction, expected_reloaded, 1e-5);
+}
+
+TEST(DaemonServer, TestOnlyWorkersWritePredictionFiles)
+{
+  const std::string model = "daemon_server_test_files.model";
+  const std::string predictions = "daemon_server_test_files.predictions";
+  const std::string raw_predictions = "daemon_server_test_files.raw_predictions";
+  auto remove_files = VW::scope_exit(
+      [&]()
+      {
+        std::remove(model.c_str());
+        std::remove(predictions.c_str());
+        std::remove(raw_predictions.c_str());
+      });
+  save_model({"--quiet", "--no_stdin"}, {"1 |a x y", "0.5 |a w", "1 |a x"}, model, false);
+
+  const size_t num_lines = 1000;
+  std::vector<std::string> responses;
+  {
+    daemon_under_test daemon({"-t", "-i", model, "-p", predictions, "-r", raw_predictions});
+    client first(daemon.port);
+    client second(daemon.port);
+    for (size_t i = 0; i < num_lines; i++)
+    {
+      auto& sender = i % 2 == 0 ? first : second;
+      ASSERT_TRUE(sender.send_data(i % 3 == 0 ? "|a x y\n" : "|a w\n"));
+      responses.push_back(sender.receive_until("\n"));
+    }
+  }
+
+  auto read_lines = [](const std::string& file)
+  {
+    std::vector<std::string> lines;
+    std::ifstream input(file);
+    for (std::string line; std::getline(input, line);) { lines.push_back(line + "\n"); }
+    return lines;
+  };
+  auto written = read_lines(predictions);
+  std::sort(written.begin(), written.end());
+  std::sort(responses.begin(), responses.end());
+  EXPECT_EQ(written, responses);
+  EXPECT_EQ(read_lines(raw_predictions).size(), num_lines);
+}
+
+TEST(DaemonServer, ClientWhichDoesNotReadDoesNotBlockOthers)
+{
+  const std::string model = "daemon_server_test_unread.model";
+  auto remove_model = VW::scope_exit([&]() { std::remove(model.c_str()); });
+  // Class probabilities make the responses much larger than the requests.
+  save_model({"--quiet", "--no_stdin", "--oaa", "100", "--probabilities", "--loss_function", "logistic"},
+      {"1 |a x y", "2 |a w", "3 |a x"}, model, false);
+
+  // A single worker, which must not wait for the client that does not read.
+  daemon_under_test daemon({"-t", "-i", model, "--probabilities"}, 1);
+
+  // Far more responses than the socket buffers hold.
+  const size_t num_lines = 10000;
+  client stalled(daemon.port, 1 << 16);
+  std::string lines;
+  for (size_t i = 0; i < num_lines; i++) { lines += "|a x\n"; }
+  const size_t sent = stalled.send_until_blocked(lines);
+
+  client other(daemon.port);
+  ASSERT_TRUE(other.send_data("|a x y\n"));
+  EXPECT_FALSE(other.receive_until("\n").empty());
+
+  // The responses were kept for the stalled client, and the rest of its input is served once it reads them.
+  std::thread sender([&]() { stalled.send_data(lines.substr(sent)); });
+  auto join_sender = VW::scope_exit([&]() { sender.join(); });
+  for (size_t i = 0; i < num_lines; i++) { ASSERT_FALSE(stalled.receive_until("\n").empty()) << i; }
+}
+
+TEST(DaemonServer, ServesMultilineExamplesAcrossTurns)
+{
+  const std::string model = "daemon_server_test_multiline.model";
+  auto remove_model = VW::scope_exit([&]() { std::remove(model.c_str()); });
+  save_model({"--quiet", "--no_stdin", "--cb_explore_adf"},
+      {"shared |s a", "0:1:0.5 |x b", "|x c", "", "shared |s a", "|x b", "0:-1:0.5 |x c", ""}, model, true);
+  auto local = VW::initialize(vwtest::make_args("--quiet", "--no_stdin", "-i", model));
+
+  daemon_under_test daemon({"-i", model});
+
+  // A text multiline example which arrives over several turns.
+  client text(daemon.port);
+  ASSERT_TRUE(text.send_data("shared |s a\n|x b\n"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_TRUE(text.send_data("|x c\n"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_TRUE(text.send_data("\nshared |s a\n|x b\n\n"));
+  EXPECT_EQ(count_actions(text.receive_until("\n\n")), 2);
+  EXPECT_EQ(count_actions(text.receive_until("\n\n")), 1);
+
+  // A binary multiline example larger than the input the daemon reads in one turn.
+  std::vector<std::string> lines = {"shared |s a"};
+  const size_t num_actions = 2000;
+  std::string features;
+  for (size_t i = 0; i < 100; i++) { features += " f" + std::to_string(i) + ":0.5"; }
+  for (size_t i = 0; i < num_actions; i++) { lines.push_back("|x b" + std::to_string(i) + features); }
+  lines.push_back("");
+  const auto records = to_binary(*local, lines);
+  ASSERT_GT(records.size(), 1u << 20);
+  client binary(daemon.port);
+  ASSERT_TRUE(binary.send_data(std::string(1, '\0') + records));
+  // Only scalar predictions have a binary reply, action scores are sent as text like to a text client.
+  const auto binary_response = binary.receive_until("\n\n");
+  EXPECT_EQ(count_actions(binary_response), num_actions);
+  std::string group;
+  for (const auto& line : lines) { group += line + "\n"; }
+  ASSERT_TRUE(text.send_data(group));
+  EXPECT_EQ(text.receive_until("\n\n"), binary_response);
+
+  // An unterminated multiline example over the limit closes the connection.
+  {
+    client oversize(daemon.port);
+    std::string action = "|x";
+    for (size_t i = 0; action.size() < (1 << 16); i++) { action += " f" + std::to_string(i); }
+    std::string group = "shared |s a\n";
+    while (group.size() < (17 << 20)) { group += action + "\n"; }
+    oversize.send_data(group);
+    EXPECT_TRUE(oversize.closed_by_daemon());
+  }
+
+  // Other connections are not affected.
+  ASSERT_TRUE(text.send_data("shared |s a\n|x b\n|x c\n\n"));
+  EXPECT_EQ(count_actions(text.receive_until("\n\n")), 2);
+}
+#endif
@@ -10,7 +10,9 @@
 
 #include <functional>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 using simulator::callback_map;
 using simulator::cb_sim;
@@ -110,6 +112,20 @@ TEST(EpsilonDecay, ChampChangeWIterations)
   EXPECT_GT(ctr.back(), 0.4f);
 }
 
+TEST(EpsilonDecay, EnsembleThreadsMatchSerialLearningWIterations)
+{
+  // The setup of ChampChangeWIterations, with the label range fixed since every thread starts an example from the
+  // label range of the learning thread.
+  const std::vector<std::string> args = {"--epsilon_decay", "--model_count", "4", "--challenger_epsilon",
+      "--cb_explore_adf", "--quiet", "-q", "::", "--min_prediction", "-1", "--max_prediction", "1"};
+  std::vector<std::string> threaded_args = args;
+  threaded_args.insert(threaded_args.end(), {"--ensemble_threads", "3"});
+
+  callback_map no_hooks;
+  const auto serial_ctr = simulator::_test_helper_hook(args, no_hooks, 610, 36, {500});
+  EXPECT_EQ(simulator::_test_helper_hook(threaded_args, no_hooks, 610, 36, {500}), serial_ctr);
+}
+
 TEST(EpsilonDecay, UpdateCountWIterations)
 {
   const size_t num_iterations = 105;
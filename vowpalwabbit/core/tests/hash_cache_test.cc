@@ -0,0 +1,73 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/hash_cache.h"
+
+#include "vw/core/vw.h"
+#include "vw/test_common/test_common.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(HashCache, CachedHasherMatchesHasher)
+{
+  const std::vector<std::string> names = {"a", "feature", "123", " padded ",
+      "a_feature_name_which_is_much_too_long_to_be_kept_in_the_cache", "feature", "a", "123"};
+  for (const auto& hasher_name : {"strings", "all"})
+  {
+    const auto hasher = VW::get_hasher(hasher_name);
+    VW::details::hash_cache cache(hasher, 1000);
+    EXPECT_EQ(cache.size(), 1024);
+    const VW::feature_hasher cached_hasher(cache);
+    EXPECT_EQ(cached_hasher.get_hash_function(), hasher);
+    EXPECT_EQ(cached_hasher.get_cache(), &cache);
+
+    for (uint32_t seed : {0u, 7u})
+    {
+      for (const auto& name : names)
+      {
+        EXPECT_EQ(cached_hasher(name.data(), name.size(), seed), hasher(name.data(), name.size(), seed)) << name;
+      }
+    }
+    const auto stats = cache.get_stats();
+    // Repeated names with the same seed are hits, unless they collided with another name.
+    EXPECT_EQ(stats.hits + stats.misses, 2 * names.size());
+    EXPECT_GE(stats.misses, 10u);
+  }
+}
+
+TEST(HashCache, HashCacheSizeOption)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "--hash_cache_size", "1024"));
+  auto* ex = VW::read_example(*vw, "|ns a b:2 c");
+  auto* ex2 = VW::read_example(*vw, "|ns a b:2 c");
+  EXPECT_THAT(ex->feature_space['n'].indices, testing::ElementsAreArray(ex2->feature_space['n'].indices));
+
+  auto uncached = VW::initialize(vwtest::make_args("--quiet"));
+  EXPECT_EQ(uncached->parser_runtime.example_parser->feature_hash_cache, nullptr);
+  auto* ex3 = VW::read_example(*uncached, "|ns a b:2 c");
+  EXPECT_THAT(ex->feature_space['n'].indices, testing::ElementsAreArray(ex3->feature_space['n'].indices));
+  EXPECT_TRUE(VW::are_features_compatible(*vw, *uncached) == nullptr);
+
+  // Every workspace counts the lookups of its own cache, and every thread has its own table in it.
+  const auto& cache = *vw->parser_runtime.example_parser->feature_hash_cache;
+  EXPECT_EQ(cache.size(), 1024);
+  const auto before = cache.get_stats();
+  auto other = VW::initialize(vwtest::make_args("--quiet", "--hash_cache_size", "16"));
+  VW::hash_feature(*other, "from_another_workspace", 0);
+  std::thread parse_thread([&vw]() { VW::hash_feature(*vw, "from_another_thread", 0); });
+  parse_thread.join();
+  const auto after = cache.get_stats();
+  EXPECT_EQ(after.hits - before.hits, 0u);
+  EXPECT_EQ(after.misses - before.misses, 1u);
+  EXPECT_EQ(other->parser_runtime.example_parser->feature_hash_cache->get_stats().misses, 1u);
+
+  VW::finish_example(*vw, *ex);
+  VW::finish_example(*vw, *ex2);
+  VW::finish_example(*uncached, *ex3);
+}
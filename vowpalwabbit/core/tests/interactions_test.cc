@@ -408,6 +408,38 @@ TEST(Interactions, ExtentVsCharInteractions)
   EXPECT_EQ(num_char_fts, num_extent_fts);
 }
 
+TEST(Interactions, PrefetchingDoesNotChangePredictions)
+{
+  auto vw = VW::initialize(vwtest::make_args("--quiet", "-q", "ab", "--cubic", "abc", "--interactions", "abca"));
+  const char* lines[] = {"1 |a x:0.5 y z |b u v:2 w |c p q", "-1 |a y |b w x:-1 |c q r s",
+      "1 |a x y z t |b u |c p:0.25"};
+  for (const auto* line : lines)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    vw->learn(*ex);
+    vw->finish_example(*ex);
+  }
+
+  auto& weights = vw->weights.dense_weights;
+  auto& cache = vw->runtime_state.generate_interactions_object_cache_state;
+  for (const auto* line : lines)
+  {
+    auto* ex = VW::read_example(*vw, line);
+    size_t num_features = 0;
+    size_t num_features_prefetched = 0;
+    const float plain = VW::inline_predict<VW::dense_parameters>(weights,
+        vw->feature_tweaks_config.ignore_some_linear, vw->feature_tweaks_config.ignore_linear, *ex->interactions,
+        *ex->extent_interactions, vw->feature_tweaks_config.permutations, *ex, num_features, cache);
+    const float prefetched = VW::inline_predict<VW::dense_parameters, VW::details::WEIGHT_PREFETCH_DISTANCE>(weights,
+        vw->feature_tweaks_config.ignore_some_linear, vw->feature_tweaks_config.ignore_linear, *ex->interactions,
+        *ex->extent_interactions, vw->feature_tweaks_config.permutations, *ex, num_features_prefetched, cache);
+    EXPECT_NE(plain, 0.f);
+    EXPECT_FLOAT_EQ(plain, prefetched);
+    EXPECT_EQ(num_features, num_features_prefetched);
+    vw->finish_example(*ex);
+  }
+}
+
 TEST(Interactions, ExtentInteractionExpansionTest)
 {
   auto vw = VW::initialize(vwtest::make_args("--quiet"));
@@ -6,11 +6,15 @@
 #include "vw/core/parse_example.h"
 #include "vw/core/parse_primitives.h"
 #include "vw/core/vw.h"
+#include "vw/io/io_adapter.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 TEST(Parser, DecodeInlineHexTest)
 {
   auto nl = VW::io::create_null_logger();
@@ -58,4 +62,76 @@ TEST(Parser, TrimWhitespaceTest)
   EXPECT_TRUE("a\nb     c" == VW::trim_whitespace(std::string("              a\nb     c               ")));
   EXPECT_TRUE("a\nb     \tc" == VW::trim_whitespace(std::string("     \t         a\nb     \tc        \t\t       ")));
   EXPECT_TRUE("" == VW::trim_whitespace(std::string("     \t                 \t\t       ")));
-}
\ No newline at end of file
+}
+TEST(Parser, ParallelParseKeepsInputOrder)
+{
+  auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--parse_threads", "4"));
+
+  const size_t num_lines = 1000;
+  std::string data;
+  for (size_t i = 0; i < num_lines; ++i) { data += std::to_string(i) + " |f a b c\n"; }
+  vw->parser_runtime.example_parser->input.add_file(VW::io::create_buffer_view(data.data(), data.size()));
+
+  VW::start_parser(*vw);
+  size_t num_examples = 0;
+  VW::example* ex = nullptr;
+  while ((ex = VW::get_example(vw->parser_runtime.example_parser.get())) != nullptr)
+  {
+    if (!ex->end_pass)
+    {
+      EXPECT_FLOAT_EQ(ex->l.simple.label, static_cast<float>(num_examples));
+      EXPECT_EQ(ex->feature_space['f'].size(), 3);
+      num_examples++;
+    }
+    VW::finish_example(*vw, *ex);
+  }
+  VW::end_parser(*vw);
+
+  EXPECT_EQ(num_examples, num_lines);
+}
+
+TEST(Parser, MappedInputIsReadInPlaceAndJoinedWithNextFile)
+{
+  const std::string file_name = "parser_mapped_input_test.txt";
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << "1 |f a\n2 |f b\n3 |f";
+  }
+  const std::string next_file = " c\n4 |f d\n";
+
+  {
+    VW::io_buf input;
+    input.add_file(VW::io::open_mapped_file_reader(file_name));
+    input.add_file(VW::io::create_buffer_view(next_file.data(), next_file.size()));
+
+    std::vector<std::string> lines;
+    char* line = nullptr;
+    size_t num_chars = 0;
+    while ((num_chars = input.readto(line, '\n')) > 0) { lines.emplace_back(line, num_chars); }
+    // The last line of the mapped file has no newline, it continues in the next file.
+    EXPECT_THAT(lines, ::testing::ElementsAre("1 |f a\n", "2 |f b\n", "3 |f c\n", "4 |f d\n"));
+  }
+  std::remove(file_name.c_str());
+}
+
+TEST(Parser, ParseTextWithLongNames)
+{
+  auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet"));
+  // Names which are longer than what is scanned at a time, ending at every kind of delimiter.
+  auto* ex = VW::read_example(
+      *vw, "|a_namespace_with_a_long_name:2 a_feature_with_a_long_name:0.5\ta_second_feature_with_a_long_name "
+           "last_feature_with_a_long_name|b x\r");
+
+  const auto ns_hash = VW::hash_space(*vw, "a_namespace_with_a_long_name");
+  // read_example sets up the example, which scales the indices by the stride.
+  auto index_of = [&](const std::string& name)
+  { return static_cast<uint64_t>(VW::hash_feature(*vw, name, ns_hash)) << vw->weights.stride_shift(); };
+  const auto& fs = ex->feature_space['a'];
+  EXPECT_THAT(fs.values, testing::ElementsAre(1.f, 2.f, 2.f));
+  EXPECT_THAT(fs.indices,
+      testing::ElementsAre(index_of("a_feature_with_a_long_name"), index_of("a_second_feature_with_a_long_name"),
+          index_of("last_feature_with_a_long_name")));
+  EXPECT_EQ(ex->feature_space['b'].size(), 1);
+
+  VW::finish_example(*vw, *ex);
+}
@@ -2,12 +2,16 @@
 // individual contributors. All rights reserved. Released under a BSD (revised)
 // license as described in the file LICENSE.
 
+#include "vw/core/learner.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 // Test case validating this issue: https://github.com/VowpalWabbit/vowpal_wabbit/issues/2166
 TEST(Predict, PredictModifyingState)
 {
@@ -43,3 +47,101 @@ TEST(Predict, PredictModifyingState)
 
   EXPECT_FLOAT_EQ(prediction_one, prediction_two);
 }
+
+namespace
+{
+// Trains on a few examples, then checks that predict_batch on a fresh batch gives the same predictions as predict.
+template <typename PredictionT>
+void check_predict_batch_matches_predict(std::unique_ptr<VW::config::options_i> args,
+    const std::vector<std::string>& lines, PredictionT VW::polyprediction::*pred)
+{
+  auto vw = VW::initialize(std::move(args));
+  for (int pass = 0; pass < 3; pass++)
+  {
+    for (const auto& line : lines)
+    {
+      auto& ex = *VW::read_example(*vw, line);
+      vw->learn(ex);
+      vw->finish_example(ex);
+    }
+  }
+
+  std::vector<PredictionT> expected;
+  for (const auto& line : lines)
+  {
+    auto& ex = *VW::read_example(*vw, line);
+    vw->predict(ex);
+    expected.push_back(ex.pred.*pred);
+    vw->finish_example(ex);
+  }
+
+  VW::multi_ex batch;
+  for (const auto& line : lines) { batch.push_back(VW::read_example(*vw, line)); }
+  vw->predict_batch(batch);
+  for (size_t i = 0; i < lines.size(); i++) { EXPECT_EQ(batch[i]->pred.*pred, expected[i]); }
+  for (auto* ex : batch) { vw->finish_example(*ex); }
+}
+
+void check_multipredict_matches_predict(std::unique_ptr<VW::config::options_i> args)
+{
+  auto vw = VW::initialize(std::move(args));
+  const std::vector<std::string> lines = {"1 |a x y |b z", "2 |a x |b w z", "3 |a y:0.5 |b w", "4 |a z |b x y",
+      "5 |a w |b y:2", "6 |a x z |b w", "7 |a y |b x"};
+  for (int pass = 0; pass < 3; pass++)
+  {
+    for (const auto& line : lines)
+    {
+      auto& ex = *VW::read_example(*vw, line);
+      vw->learn(ex);
+      vw->finish_example(ex);
+    }
+  }
+
+  auto* gd = vw->l->get_learner_by_name_prefix("gd");
+  for (const auto& line : lines)
+  {
+    auto& ex = *VW::read_example(*vw, line);
+    std::vector<VW::polyprediction> preds(lines.size());
+    gd->multipredict(ex, 0, lines.size(), preds.data(), false);
+    for (size_t c = 0; c < lines.size(); c++)
+    {
+      gd->predict(ex, c);
+      EXPECT_EQ(preds[c].scalar, ex.partial_prediction);
+    }
+    vw->finish_example(ex);
+  }
+}
+}  // namespace
+
+TEST(Predict, PredictBatchMatchesPredictScalar)
+{
+  check_predict_batch_matches_predict(
+      vwtest::make_args("--quiet", "--link", "logistic", "--loss_function", "logistic", "-q", "ab"),
+      {"1 |a x y |b z", "-1 |a x |b w z", "1 |a y |b w", "-1 |a z |b x y"}, &VW::polyprediction::scalar);
+}
+
+TEST(Predict, PredictBatchMatchesPredictOaa)
+{
+  check_predict_batch_matches_predict(vwtest::make_args("--quiet", "--oaa", "3"),
+      {"1 | a b", "2 | b c", "3 | c d", "1 | a d"}, &VW::polyprediction::multiclass);
+}
+
+// sgd, adaptive and the default update keep one, two and four weights per feature. With 4 bits, the classes of many
+// features wrap around the end of the weights.
+TEST(Predict, MultipredictMatchesPredictSgd)
+{
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab", "--sgd"));
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab", "--sgd", "-b", "4"));
+}
+
+TEST(Predict, MultipredictMatchesPredictAdaptive)
+{
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab", "--adaptive"));
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab", "--adaptive", "-b", "4"));
+}
+
+TEST(Predict, MultipredictMatchesPredictDefault)
+{
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab"));
+  check_multipredict_matches_predict(vwtest::make_args("--quiet", "--oaa", "7", "-q", "ab", "-b", "4"));
+}
@@ -0,0 +1,158 @@
+// Copyright (c) by respective owners including Yahoo!, Microsoft, and
+// individual contributors. All rights reserved. Released under a BSD (revised)
+// license as described in the file LICENSE.
+
+#include "vw/core/queue.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST(RingQueue, PushPopKeepsOrder)
+{
+  VW::ring_queue<int> queue(3);
+  for (int round = 0; round < 4; round++)
+  {
+    queue.push(round);
+    queue.push(round + 10);
+    EXPECT_EQ(queue.size(), 2u);
+
+    int item = -1;
+    EXPECT_TRUE(queue.try_pop(item));
+    EXPECT_EQ(item, round);
+    EXPECT_TRUE(queue.try_pop(item));
+    EXPECT_EQ(item, round + 10);
+    EXPECT_EQ(queue.size(), 0u);
+  }
+}
+
+TEST(RingQueue, TryPopReturnsFalseWhenDoneAndEmpty)
+{
+  VW::ring_queue<int> queue(4);
+  queue.push(1);
+  queue.set_done();
+
+  int item = 0;
+  EXPECT_TRUE(queue.try_pop(item));
+  EXPECT_EQ(item, 1);
+  EXPECT_FALSE(queue.try_pop(item));
+}
+
+TEST(RingQueue, SetDoneWakesParkedConsumer)
+{
+  VW::ring_queue<int> queue(4);
+  bool popped = true;
+  std::thread consumer(
+      [&]()
+      {
+        int item = 0;
+        popped = queue.try_pop(item);
+      });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  queue.set_done();
+  consumer.join();
+  EXPECT_FALSE(popped);
+}
+
+TEST(RingQueue, SingleProducerSingleConsumerWithBatches)
+{
+  const int num_items = 100000;
+  VW::ring_queue<int> queue(16);
+
+  std::thread producer(
+      [&]()
+      {
+        std::vector<int> batch;
+        for (int i = 0; i < num_items; i++)
+        {
+          batch.push_back(i);
+          // Batches larger than the capacity must not deadlock.
+          if (batch.size() == 37)
+          {
+            queue.push_batch(batch.begin(), batch.end());
+            batch.clear();
+          }
+        }
+        queue.push_batch(batch.begin(), batch.end());
+        queue.set_done();
+      });
+
+  int expected = 0;
+  int item = 0;
+  while (queue.try_pop(item))
+  {
+    EXPECT_EQ(item, expected);
+    expected++;
+  }
+  producer.join();
+  EXPECT_EQ(expected, num_items);
+}
+
+TEST(RingQueue, CapacityOfOneKeepsOrder)
+{
+  const int num_items = 10000;
+  VW::ring_queue<int> queue(1);
+
+  std::thread producer(
+      [&]()
+      {
+        for (int i = 0; i < num_items; i++) { queue.push(i); }
+        queue.set_done();
+      });
+
+  int expected = 0;
+  int item = 0;
+  while (queue.try_pop(item))
+  {
+    EXPECT_EQ(item, expected);
+    expected++;
+  }
+  producer.join();
+  EXPECT_EQ(expected, num_items);
+}
+
+TEST(RingQueue, MultipleProducersMultipleConsumers)
+{
+  const size_t num_producers = 4;
+  const size_t num_consumers = 4;
+  const size_t items_per_producer = 20000;
+  VW::ring_queue<size_t> queue(8);
+
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < num_producers; p++)
+  {
+    producers.emplace_back(
+        [&, p]()
+        {
+          for (size_t i = 0; i < items_per_producer; i++) { queue.push(p * items_per_producer + i); }
+        });
+  }
+
+  std::vector<std::vector<size_t>> consumed(num_consumers);
+  std::vector<std::thread> consumers;
+  for (size_t c = 0; c < num_consumers; c++)
+  {
+    consumers.emplace_back(
+        [&, c]()
+        {
+          size_t item = 0;
+          while (queue.try_pop(item)) { consumed[c].push_back(item); }
+        });
+  }
+
+  for (auto& t : producers) { t.join(); }
+  queue.set_done();
+  for (auto& t : consumers) { t.join(); }
+
+  std::vector<size_t> all_items;
+  for (const auto& items : consumed) { all_items.insert(all_items.end(), items.begin(), items.end()); }
+  std::sort(all_items.begin(), all_items.end());
+  std::vector<size_t> expected(num_producers * items_per_producer);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(all_items, expected);
+}
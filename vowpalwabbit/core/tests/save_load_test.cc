@@ -3,6 +3,9 @@
 // license as described in the file LICENSE.
 
 #include "vw/config/options_cli.h"
+#include "vw/core/learner.h"
+#include "vw/core/prediction_type.h"
+#include "vw/core/scope_exit.h"
 #include "vw/core/shared_data.h"
 #include "vw/core/vw.h"
 #include "vw/test_common/test_common.h"
@@ -11,6 +14,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <memory>
 
 using namespace ::testing;
@@ -85,3 +89,203 @@ TEST(SaveLoad, SaveResumeBehavesAsIfDatasetConcatenated)
   EXPECT_EQ(vw_all_data_single_run->sd->weighted_examples(), vw_second_half_from_loaded->sd->weighted_examples());
   EXPECT_EQ(vw_all_data_single_run->sd->sum_loss, vw_second_half_from_loaded->sd->sum_loss);
 }
+
+TEST(SaveLoad, MmapModelMatchesRegularModel)
+{
+  const std::string regular_model = "save_load_test_regular.model";
+  const std::string mmap_model = "save_load_test_mmap.model";
+  auto remove_models = VW::scope_exit(
+      [&]()
+      {
+        std::remove(regular_model.c_str());
+        std::remove(mmap_model.c_str());
+      });
+
+  const std::vector<std::string> train_data = {"1 |a x y |b z", "-1 |a x w |b q", "1 |a y |b z q", "-1 |a w"};
+  const std::string test_example = "|a x y w |b z q";
+
+  auto predict = [&](VW::workspace& vw, const std::string& line)
+  {
+    auto& ex = VW::get_unused_example(&vw);
+    VW::parsers::text::read_line(vw, &ex, line.c_str());
+    VW::setup_example(vw, &ex);
+    vw.predict(ex);
+    const float prediction = ex.pred.scalar;
+    vw.finish_example(ex);
+    return prediction;
+  };
+  auto learn = [&](VW::workspace& vw, const std::string& line)
+  {
+    auto& ex = VW::get_unused_example(&vw);
+    VW::parsers::text::read_line(vw, &ex, line.c_str());
+    VW::setup_example(vw, &ex);
+    vw.learn(ex);
+    vw.finish_example(ex);
+  };
+
+  {
+    auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-q", "ab", "--mmap_model"));
+    for (const auto& line : train_data) { learn(*vw, line); }
+    VW::save_predictor(*vw, mmap_model);
+    vw->output_model_config.mmap_model = false;
+    VW::save_predictor(*vw, regular_model);
+  }
+
+  auto from_regular = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", regular_model));
+  auto from_mmap = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", mmap_model));
+  auto from_mmap_read_only =
+      VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "--mmap_read_only", "-i", mmap_model));
+
+  const float expected = predict(*from_regular, test_example);
+  EXPECT_NE(expected, 0.f);
+  EXPECT_FLOAT_EQ(predict(*from_mmap, test_example), expected);
+  EXPECT_FLOAT_EQ(predict(*from_mmap_read_only, test_example), expected);
+
+  // Learning on a copy-on-write mapping continues exactly like learning on a regular model.
+  auto resumed_regular = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-i", regular_model));
+  auto resumed_mmap = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-i", mmap_model));
+  for (const auto& line : train_data)
+  {
+    learn(*resumed_regular, line);
+    learn(*resumed_mmap, line);
+  }
+  EXPECT_FLOAT_EQ(predict(*resumed_mmap, test_example), predict(*resumed_regular, test_example));
+
+  // The mapping is private, so learning did not change the file.
+  auto reloaded_mmap = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", mmap_model));
+  EXPECT_FLOAT_EQ(predict(*reloaded_mmap, test_example), expected);
+}
+
+TEST(SaveLoad, MmapReadOnlyRequiresTestOnly)
+{
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--mmap_read_only")), VW::vw_exception);
+}
+
+TEST(SaveLoad, MmapReadOnlyKeepsL2State)
+{
+  const std::string regular_model = "save_load_test_l2_regular.model";
+  const std::string mmap_model = "save_load_test_l2_mmap.model";
+  auto remove_models = VW::scope_exit(
+      [&]()
+      {
+        std::remove(regular_model.c_str());
+        std::remove(mmap_model.c_str());
+      });
+
+  const std::vector<std::string> train_data = {"1 |a x y", "-1 |a x w", "1 |a y z", "-1 |a w"};
+  const std::string test_example = "|a x y w z";
+
+  auto run = [&](VW::workspace& vw, const std::string& line, bool learn)
+  {
+    auto& ex = VW::get_unused_example(&vw);
+    VW::parsers::text::read_line(vw, &ex, line.c_str());
+    VW::setup_example(vw, &ex);
+    if (learn) { vw.learn(ex); }
+    else { vw.predict(ex); }
+    const float prediction = ex.pred.scalar;
+    vw.finish_example(ex);
+    return prediction;
+  };
+
+  {
+    auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--l2", "1e-3", "--mmap_model"));
+    for (const auto& line : train_data) { run(*vw, line, true); }
+    EXPECT_NE(vw->sd->contraction, 1.);
+    VW::save_predictor(*vw, mmap_model);
+    vw->output_model_config.mmap_model = false;
+    VW::save_predictor(*vw, regular_model);
+  }
+
+  // The weights cannot be rescaled in place, so the contraction is applied when predicting.
+  auto from_regular = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", regular_model));
+  auto from_mmap_read_only =
+      VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "--mmap_read_only", "-i", mmap_model));
+  const float expected = run(*from_regular, test_example, false);
+  EXPECT_NE(expected, 0.f);
+  EXPECT_FLOAT_EQ(run(*from_mmap_read_only, test_example, false), expected);
+  // Finishing must not fold the l2 state into the read-only weights either.
+  from_mmap_read_only->finish();
+}
+
+TEST(SaveLoad, MmapReadOnlyRejectsL1State)
+{
+  const std::string mmap_model = "save_load_test_l1_mmap.model";
+  auto remove_model = VW::scope_exit([&]() { std::remove(mmap_model.c_str()); });
+
+  {
+    auto vw = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "--l1", "1e-3", "--mmap_model"));
+    auto& ex = VW::get_unused_example(vw.get());
+    VW::parsers::text::read_line(*vw, &ex, "1 |a x y");
+    VW::setup_example(*vw, &ex);
+    vw->learn(ex);
+    vw->finish_example(ex);
+    VW::save_predictor(*vw, mmap_model);
+  }
+
+  EXPECT_THROW(VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "--mmap_read_only", "-i", mmap_model)),
+      VW::vw_exception);
+}
+
+TEST(SaveLoad, MmapModelWithGdMfAndLda)
+{
+  const std::string regular_model = "save_load_test_bottom_regular.model";
+  const std::string mmap_model = "save_load_test_bottom_mmap.model";
+  auto remove_models = VW::scope_exit(
+      [&]()
+      {
+        std::remove(regular_model.c_str());
+        std::remove(mmap_model.c_str());
+      });
+
+  auto run = [&](VW::workspace& vw, const std::string& line, bool learn)
+  {
+    auto& ex = VW::get_unused_example(&vw);
+    VW::parsers::text::read_line(vw, &ex, line.c_str());
+    VW::setup_example(vw, &ex);
+    if (learn) { vw.learn(ex); }
+    else { vw.predict(ex); }
+    const auto prediction = vw.l->get_output_prediction_type() == VW::prediction_type_t::SCALARS
+        ? std::vector<float>(ex.pred.scalars.begin(), ex.pred.scalars.end())
+        : std::vector<float>{ex.pred.scalar};
+    vw.finish_example(ex);
+    return prediction;
+  };
+  auto save_models = [&](std::vector<std::string> args, const std::vector<std::string>& train_data)
+  {
+    args.push_back("--mmap_model");
+    auto vw = VW::initialize(vwtest::make_args(args));
+    for (const auto& line : train_data) { run(*vw, line, true); }
+    VW::save_predictor(*vw, mmap_model);
+    vw->output_model_config.mmap_model = false;
+    VW::save_predictor(*vw, regular_model);
+  };
+
+  save_models({"--no_stdin", "--quiet", "--rank", "2", "-q", "ab"},
+      {"1 |a x y |b z", "-1 |a x w |b q", "1 |a y |b z q", "-1 |a w |b z"});
+  {
+    const std::string test_example = "|a x y w |b z q";
+    auto from_regular = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", regular_model));
+    auto from_mmap = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", mmap_model));
+    auto from_mmap_read_only =
+        VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "--mmap_read_only", "-i", mmap_model));
+    const auto expected = run(*from_regular, test_example, false);
+    EXPECT_NE(expected[0], 0.f);
+    EXPECT_THAT(run(*from_mmap, test_example, false), Pointwise(FloatEq(), expected));
+    EXPECT_THAT(run(*from_mmap_read_only, test_example, false), Pointwise(FloatEq(), expected));
+  }
+
+  // lda updates its weights while predicting, so it can only use the copy-on-write mapping.
+  save_models({"--no_stdin", "--quiet", "--lda", "3", "--lda_D", "4", "-b", "10"},
+      {"| x:2 y:1 z:1", "| w:3 q:1", "| x:1 y:2 q:1", "| z:2 w:1"});
+  {
+    const std::string test_example = "| x:1 y:1 w:1";
+    auto from_regular = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", regular_model));
+    auto from_mmap = VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "-i", mmap_model));
+    const auto expected = run(*from_regular, test_example, false);
+    EXPECT_EQ(expected.size(), 3);
+    EXPECT_THAT(run(*from_mmap, test_example, false), Pointwise(FloatEq(), expected));
+    EXPECT_THROW(
+        VW::initialize(vwtest::make_args("--no_stdin", "--quiet", "-t", "--mmap_read_only", "-i", mmap_model)),
+        VW::vw_exception);
+  }
+}
@@ -8,7 +8,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdlib>
 #include <cstring>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -142,3 +144,45 @@ TEST(Tokenize, MixedQuotesSplitCommandLine)
   auto args = VW::split_command_line(VW::string_view(R"("this is 'a quoted'" '"unclosed')"));
   EXPECT_THAT(args, ElementsAre(StrEq("this is 'a quoted'"), StrEq("\"unclosed")));
 }
+
+TEST(ParseFloat, ParseFloatIsCorrectlyRounded)
+{
+  const std::vector<std::string> inputs = {"0.1", "0.0546448", "123.456", "-2.5", "1e-5", "0.30000001", "7.038531e-26",
+      "3.4028235e38", "16777217", "1.00000005960464477539", "0.000000000000000000000001", "123456789012345",
+      "1234567890123456789", "1e+5", "-0", "5.", ".5"};
+  for (const auto& input : inputs)
+  {
+    size_t end_idx = 0;
+    const float parsed = VW::details::parse_float(input.data(), end_idx, input.data() + input.size());
+    EXPECT_EQ(parsed, std::strtof(input.c_str(), nullptr)) << input;
+    EXPECT_EQ(end_idx, input.size()) << input;
+  }
+
+  // Random decimals with up to 9 significant digits and small exponents take the fast path.
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> mantissa(0, 999999999);
+  std::uniform_int_distribution<int> exponent(-30, 30);
+  for (int i = 0; i < 10000; i++)
+  {
+    const std::string input = std::to_string(mantissa(random)) + "e" + std::to_string(exponent(random));
+    size_t end_idx = 0;
+    const float parsed = VW::details::parse_float(input.data(), end_idx, input.data() + input.size());
+    EXPECT_EQ(parsed, std::strtof(input.c_str(), nullptr)) << input;
+  }
+}
+
+TEST(ParseFloat, ParseFloatStopsAtDelimiters)
+{
+  const std::string input = "1.5 2.5\t-3.25|4.5";
+  size_t end_idx = 0;
+  EXPECT_FLOAT_EQ(VW::details::parse_float(input.data(), end_idx, input.data() + input.size()), 1.5f);
+  EXPECT_EQ(end_idx, 3);
+  EXPECT_FLOAT_EQ(VW::details::parse_float(input.data() + 4, end_idx, input.data() + input.size()), 2.5f);
+  EXPECT_EQ(end_idx, 3);
+  EXPECT_FLOAT_EQ(VW::details::parse_float(input.data() + 8, end_idx, input.data() + input.size()), -3.25f);
+  EXPECT_EQ(end_idx, 5);
+
+  const std::string not_a_number = "abc";
+  EXPECT_FLOAT_EQ(VW::details::parse_float(not_a_number.data(), end_idx, not_a_number.data() + 3), 0.f);
+  EXPECT_EQ(end_idx, 0);
+}
@@ -3,6 +3,8 @@
 // license as described in the file LICENSE.
 
 #include "vw/core/array_parameters.h"
+
+#include "vw/common/vw_exception.h"
 #include "vw/core/array_parameters_dense.h"
 
 #include <gmock/gmock.h>
@@ -24,4 +26,28 @@ TYPED_TEST(WeightTests, TestDefaultFunctionWeightInitializationStridedIndex)
   auto weight_initializer = [](VW::weight* weights, uint64_t index) { weights[0] = 1.f * index; };
   w.set_default(weight_initializer);
   for (size_t i = 0; i < LENGTH; i++) { EXPECT_FLOAT_EQ(w.strided_index(i), 1.f * (i * w.stride())); }
-}
\ No newline at end of file
+}
+#ifndef _WIN32
+TEST(Weights, DenseAllocationOptionsAreKeptByDeepCopy)
+{
+  VW::dense_allocation_options allocation;
+  allocation.prefault = true;
+  VW::dense_parameters w(LENGTH, STRIDE_SHIFT, allocation);
+  for (size_t i = 0; i < LENGTH; i++)
+  {
+    EXPECT_FLOAT_EQ(w.strided_index(i), 0.f);
+    w.strided_index(i) = 1.f * i;
+  }
+
+  auto copy = VW::dense_parameters::deep_copy(w);
+  EXPECT_TRUE(copy.allocation().prefault);
+  for (size_t i = 0; i < LENGTH; i++) { EXPECT_FLOAT_EQ(copy.strided_index(i), 1.f * i); }
+}
+#endif
+
+TEST(Weights, DenseAllocationOptionsFromString)
+{
+  EXPECT_EQ(VW::huge_pages_from_string("2mb"), VW::huge_pages::EXPLICIT_2MB);
+  EXPECT_EQ(VW::numa_policy_from_string("interleave"), VW::numa_policy::INTERLEAVE);
+  EXPECT_THROW(VW::huge_pages_from_string("4kb"), VW::vw_exception);
+}
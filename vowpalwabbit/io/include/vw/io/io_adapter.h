@@ -45,6 +45,16 @@ public:
   /// \returns the number of bytes successfully read into buffer
   virtual ssize_t read(char* buffer, size_t num_bytes) = 0;
 
+  /// Readers which hold their contents in memory can hand out the unread part
+  /// of it, so that it can be parsed in place instead of being copied by read.
+  /// The returned bytes count as read and stay valid until the reader is reset
+  /// or destroyed. They may be modified, which does not change the underlying
+  /// file.
+  /// \param data set to the beginning of the unread contents
+  /// \param num_bytes set to the number of unread bytes
+  /// \returns false if this reader does not support views, read must be used instead
+  virtual bool read_view(char*& data, size_t& num_bytes);
+
   /// This function will throw if the reader does not support reseting. Users
   /// should check if this io_adapter is resetable before trying to reset.
   /// \throw VW::vw_exception if reader does not support resetting.
@@ -98,8 +108,19 @@ private:
 
 std::unique_ptr<writer> open_file_writer(const std::string& file_path);
 std::unique_ptr<reader> open_file_reader(const std::string& file_path);
+/// Maps the file into memory and reads from the mapping, which supports
+/// read_view. Falls back to open_file_reader for files which cannot be mapped,
+/// such as pipes, and on platforms without mmap.
+std::unique_ptr<reader> open_mapped_file_reader(const std::string& file_path);
 std::unique_ptr<writer> open_compressed_file_writer(const std::string& file_path);
 std::unique_ptr<reader> open_compressed_file_reader(const std::string& file_path);
+/// Decompresses gzip input on background threads ahead of the reader. BGZF
+/// files, whose gzip members each hold one block of at most 64KiB, have their
+/// blocks inflated in parallel on num_threads threads. Other gzip files,
+/// including concatenated members, are inflated on a single thread and input
+/// which is not compressed is read as is. Uses open_compressed_file_reader
+/// if num_threads is 0.
+std::unique_ptr<reader> open_threaded_compressed_file_reader(const std::string& file_path, size_t num_threads);
 std::unique_ptr<reader> open_compressed_stdin();
 std::unique_ptr<writer> open_compressed_stdout();
 std::unique_ptr<reader> open_stdin();
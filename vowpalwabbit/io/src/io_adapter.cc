@@ -13,6 +13,7 @@
 #  include <io.h>
 #  include <winsock2.h>
 #else
+#  include <sys/mman.h>
 #  include <sys/socket.h>
 #  include <unistd.h>
 #endif
@@ -24,10 +25,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <deque>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <vector>
 #if (ZLIB_VERNUM < 0x1252)
 typedef void* gzFile;
@@ -145,6 +151,57 @@ private:
   gzFile _gz_stdout;
 };
 
+// Decompresses gzip input on background threads ahead of the consumer, see open_threaded_compressed_file_reader.
+class threaded_gzip_adapter : public reader
+{
+public:
+  threaded_gzip_adapter(std::unique_ptr<file_adapter> file, size_t num_threads);
+  ~threaded_gzip_adapter() override;
+  ssize_t read(char* buffer, size_t num_bytes) override;
+  void reset() override;
+
+private:
+  class chunk
+  {
+  public:
+    std::vector<char> compressed;
+    std::vector<char> data;
+    bool ready = false;
+    std::exception_ptr error;
+  };
+
+  void start();
+  void stop();
+  // Reads the input and splits it into chunks.
+  void produce();
+  // Inflates the BGZF blocks queued by produce, run by each worker thread.
+  void inflate_blocks();
+  void produce_bgzf(std::vector<char> input);
+  void produce_stream(std::vector<char> input);
+  // Returns false when the adapter is being stopped.
+  bool push_chunk(const std::shared_ptr<chunk>& c, bool needs_inflate);
+  size_t read_input(std::vector<char>& input, size_t num_bytes);
+
+  std::unique_ptr<file_adapter> _file;
+  size_t _num_threads;
+
+  std::mutex _mutex;
+  std::condition_variable _chunk_ready;
+  std::condition_variable _space_available;
+  std::condition_variable _work_available;
+  // Chunks in input order, bounded so that decompression does not run too far ahead of the consumer.
+  std::deque<std::shared_ptr<chunk>> _chunks;
+  std::deque<std::shared_ptr<chunk>> _to_inflate;
+  size_t _max_chunks;
+  bool _producer_done = false;
+  bool _stopping = false;
+  std::thread _producer;
+  std::vector<std::thread> _workers;
+
+  std::shared_ptr<chunk> _current;
+  size_t _current_offset = 0;
+};
+
 class custom_func_writer : public writer
 {
 public:
@@ -182,12 +239,32 @@ private:
   size_t _len;
 };
 
+#ifndef _WIN32
+class mapped_file_adapter : public reader
+{
+public:
+  // Takes ownership of file_descriptor and of the mapping of size bytes at data.
+  mapped_file_adapter(int file_descriptor, char* data, size_t size);
+  ~mapped_file_adapter() override;
+  ssize_t read(char* buffer, size_t num_bytes) override;
+  bool read_view(char*& data, size_t& num_bytes) override;
+  void reset() override;
+
+private:
+  int _file_descriptor;
+  char* _data;
+  size_t _size;
+  size_t _read_offset = 0;
+};
+#endif
+
 namespace VW
 {
 namespace io
 {
 
 void reader::reset() { THROW("Reset not supported for this io_adapter"); }
+bool reader::read_view(char*& /*data*/, size_t& /*num_bytes*/) { return false; }
 std::unique_ptr<writer> open_file_writer(const std::string& file_path)
 {
   return std::unique_ptr<writer>(new file_adapter(file_path.c_str(), file_mode::WRITE));
@@ -198,6 +275,34 @@ std::unique_ptr<reader> open_file_reader(const std::string& file_path)
   return std::unique_ptr<reader>(new file_adapter(file_path.c_str(), file_mode::READ));
 }
 
+std::unique_ptr<reader> open_mapped_file_reader(const std::string& file_path)
+{
+#ifdef _WIN32
+  return open_file_reader(file_path);
+#else
+  const int file_descriptor = open(file_path.c_str(), O_RDONLY | O_LARGEFILE);
+  if (file_descriptor == -1) { THROWERRNO("can't open: " << file_path); }
+
+  struct stat file_stat;
+  if (fstat(file_descriptor, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) || file_stat.st_size == 0)
+  {
+    close(file_descriptor);
+    return open_file_reader(file_path);
+  }
+
+  // The mapping is private and writable since some parsers, such as the JSON parser, parse in place.
+  const auto size = static_cast<size_t>(file_stat.st_size);
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file_descriptor, 0);
+  if (data == MAP_FAILED)
+  {
+    close(file_descriptor);
+    return open_file_reader(file_path);
+  }
+  madvise(data, size, MADV_SEQUENTIAL);
+  return std::unique_ptr<reader>(new mapped_file_adapter(file_descriptor, static_cast<char*>(data), size));
+#endif
+}
+
 std::unique_ptr<writer> open_compressed_file_writer(const std::string& file_path)
 {
   return std::unique_ptr<writer>(new gzip_file_adapter(file_path.c_str(), file_mode::WRITE));
@@ -208,6 +313,13 @@ std::unique_ptr<reader> open_compressed_file_reader(const std::string& file_path
   return std::unique_ptr<reader>(new gzip_file_adapter(file_path.c_str(), file_mode::READ));
 }
 
+std::unique_ptr<reader> open_threaded_compressed_file_reader(const std::string& file_path, size_t num_threads)
+{
+  if (num_threads == 0) { return open_compressed_file_reader(file_path); }
+  return std::unique_ptr<reader>(new threaded_gzip_adapter(
+      std::unique_ptr<file_adapter>(new file_adapter(file_path.c_str(), file_mode::READ)), num_threads));
+}
+
 std::unique_ptr<reader> open_compressed_stdin() { return std::unique_ptr<reader>(new gzip_stdio_adapter()); }
 
 std::unique_ptr<writer> open_compressed_stdout() { return std::unique_ptr<writer>(new gzip_stdio_adapter()); }
@@ -358,6 +470,50 @@ file_adapter::~file_adapter()
   }
 }
 
+#ifndef _WIN32
+//
+// mapped_file_adapter
+//
+
+mapped_file_adapter::mapped_file_adapter(int file_descriptor, char* data, size_t size)
+    : reader(true /*is_resettable*/), _file_descriptor(file_descriptor), _data(data), _size(size)
+{
+}
+
+mapped_file_adapter::~mapped_file_adapter()
+{
+  munmap(_data, _size);
+  ::close(_file_descriptor);
+}
+
+ssize_t mapped_file_adapter::read(char* buffer, size_t num_bytes)
+{
+  num_bytes = std::min(num_bytes, _size - _read_offset);
+  std::memcpy(buffer, _data + _read_offset, num_bytes);
+  _read_offset += num_bytes;
+  return static_cast<ssize_t>(num_bytes);
+}
+
+bool mapped_file_adapter::read_view(char*& data, size_t& num_bytes)
+{
+  data = _data + _read_offset;
+  num_bytes = _size - _read_offset;
+  _read_offset = _size;
+  return true;
+}
+
+void mapped_file_adapter::reset()
+{
+  // Map the file again in place so that pages modified by in place parsing are read from the file again.
+  if (mmap(_data, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, _file_descriptor, 0) == MAP_FAILED)
+  {
+    THROWERRNO("failed to map input file again");
+  }
+  madvise(_data, _size, MADV_SEQUENTIAL);
+  _read_offset = 0;
+}
+#endif
+
 //
 // gzip_file_adapter
 //
@@ -395,6 +551,329 @@ ssize_t gzip_file_adapter::write(const char* buffer, size_t num_bytes)
 
 void gzip_file_adapter::reset() { gzseek(_gz_file, 0, SEEK_SET); }
 
+//
+// threaded_gzip_adapter
+//
+
+namespace
+{
+// Compressed bytes read from the file at a time when streaming.
+constexpr size_t GZIP_READ_SIZE = 1 << 18;
+// Decompressed bytes in each chunk when streaming.
+constexpr size_t GZIP_CHUNK_SIZE = 1 << 20;
+// BGZF blocks are at most 64KiB, keeping more than that buffered means a whole block is always available.
+constexpr size_t BGZF_READ_AHEAD = 1 << 17;
+
+uint32_t read_le32(const unsigned char* bytes)
+{
+  return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+      (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+// Returns the size of the BGZF block at the start of data, or 0 if data does not start with a BGZF block.
+size_t bgzf_block_size(const char* data, size_t size)
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  // gzip magic, deflate and the FEXTRA flag.
+  if (size < 12 || bytes[0] != 0x1f || bytes[1] != 0x8b || bytes[2] != 8 || (bytes[3] & 4) == 0) { return 0; }
+  const size_t extra_end = 12 + (bytes[10] | (bytes[11] << 8));
+  if (size < extra_end) { return 0; }
+  for (size_t i = 12; i + 4 <= extra_end;)
+  {
+    const size_t field_size = bytes[i + 2] | (bytes[i + 3] << 8);
+    if (bytes[i] == 'B' && bytes[i + 1] == 'C' && field_size == 2 && i + 6 <= extra_end)
+    {
+      return (bytes[i + 4] | (bytes[i + 5] << 8)) + 1;
+    }
+    i += 4 + field_size;
+  }
+  return 0;
+}
+
+// Inflates one BGZF block, which is a complete gzip member.
+std::vector<char> inflate_bgzf_block(const std::vector<char>& block)
+{
+  const auto* bytes = reinterpret_cast<const unsigned char*>(block.data());
+  const size_t header_size = 12 + (bytes[10] | (bytes[11] << 8));
+  if (block.size() < header_size + 8) { THROW("Truncated BGZF block"); }
+  const uint32_t expected_checksum = read_le32(bytes + block.size() - 8);
+  std::vector<char> data(read_le32(bytes + block.size() - 4));
+  // The empty block marking the end of a file has nothing to inflate.
+  if (data.empty()) { return data; }
+
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+  if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) { THROW("Failed to initialize zlib"); }
+  stream.next_in = const_cast<Bytef*>(bytes + header_size);
+  stream.avail_in = static_cast<uInt>(block.size() - header_size - 8);
+  stream.next_out = reinterpret_cast<Bytef*>(data.data());
+  stream.avail_out = static_cast<uInt>(data.size());
+  const int result = inflate(&stream, Z_FINISH);
+  const auto total_out = stream.total_out;
+  inflateEnd(&stream);
+  if (result != Z_STREAM_END || total_out != data.size()) { THROW("Failed to decompress BGZF block"); }
+  if (crc32(0L, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size())) != expected_checksum)
+  {
+    THROW("Checksum mismatch in BGZF block");
+  }
+  return data;
+}
+
+class inflate_stream
+{
+public:
+  inflate_stream()
+  {
+    std::memset(&stream, 0, sizeof(stream));
+    // Accepts gzip and zlib headers.
+    if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK) { THROW("Failed to initialize zlib"); }
+  }
+  ~inflate_stream() { inflateEnd(&stream); }
+  inflate_stream(const inflate_stream&) = delete;
+  inflate_stream& operator=(const inflate_stream&) = delete;
+
+  z_stream stream;
+};
+}  // namespace
+
+threaded_gzip_adapter::threaded_gzip_adapter(std::unique_ptr<file_adapter> file, size_t num_threads)
+    : reader(true /*is_resettable*/)
+    , _file(std::move(file))
+    , _num_threads(num_threads)
+    , _max_chunks(8 * num_threads + 8)
+{
+  start();
+}
+
+threaded_gzip_adapter::~threaded_gzip_adapter() { stop(); }
+
+ssize_t threaded_gzip_adapter::read(char* buffer, size_t num_bytes)
+{
+  while (_current == nullptr || _current_offset == _current->data.size())
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _chunk_ready.wait(
+        lock, [this] { return (!_chunks.empty() && _chunks.front()->ready) || (_chunks.empty() && _producer_done); });
+    if (_chunks.empty()) { return 0; }
+    _current = std::move(_chunks.front());
+    _chunks.pop_front();
+    _current_offset = 0;
+    _space_available.notify_one();
+    if (_current->error != nullptr) { std::rethrow_exception(_current->error); }
+  }
+
+  num_bytes = std::min(num_bytes, _current->data.size() - _current_offset);
+  std::memcpy(buffer, _current->data.data() + _current_offset, num_bytes);
+  _current_offset += num_bytes;
+  return static_cast<ssize_t>(num_bytes);
+}
+
+void threaded_gzip_adapter::reset()
+{
+  stop();
+  _file->reset();
+  start();
+}
+
+void threaded_gzip_adapter::start()
+{
+  _producer_done = false;
+  _stopping = false;
+  _producer = std::thread(&threaded_gzip_adapter::produce, this);
+  for (size_t i = 0; i < _num_threads; i++) { _workers.emplace_back(&threaded_gzip_adapter::inflate_blocks, this); }
+}
+
+void threaded_gzip_adapter::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _space_available.notify_all();
+  _work_available.notify_all();
+  if (_producer.joinable()) { _producer.join(); }
+  for (auto& worker : _workers) { worker.join(); }
+  _workers.clear();
+  _chunks.clear();
+  _to_inflate.clear();
+  _current.reset();
+  _current_offset = 0;
+}
+
+void threaded_gzip_adapter::produce()
+{
+  try
+  {
+    std::vector<char> input;
+    read_input(input, BGZF_READ_AHEAD);
+    if (bgzf_block_size(input.data(), input.size()) != 0) { produce_bgzf(std::move(input)); }
+    else { produce_stream(std::move(input)); }
+  }
+  catch (...)
+  {
+    auto failed = std::make_shared<chunk>();
+    failed->error = std::current_exception();
+    failed->ready = true;
+    push_chunk(failed, false);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _producer_done = true;
+  }
+  _chunk_ready.notify_all();
+  _work_available.notify_all();
+}
+
+void threaded_gzip_adapter::produce_bgzf(std::vector<char> input)
+{
+  size_t offset = 0;
+  while (true)
+  {
+    if (input.size() - offset < BGZF_READ_AHEAD)
+    {
+      input.erase(input.begin(), input.begin() + offset);
+      offset = 0;
+      read_input(input, BGZF_READ_AHEAD);
+    }
+    if (offset == input.size()) { return; }
+
+    const size_t block_size = bgzf_block_size(input.data() + offset, input.size() - offset);
+    if (block_size == 0) { THROW("Invalid BGZF block in compressed input"); }
+    if (block_size > input.size() - offset) { THROW("Truncated BGZF block in compressed input"); }
+
+    auto block = std::make_shared<chunk>();
+    block->compressed.assign(input.begin() + offset, input.begin() + offset + block_size);
+    offset += block_size;
+    if (!push_chunk(block, true)) { return; }
+  }
+}
+
+void threaded_gzip_adapter::produce_stream(std::vector<char> input)
+{
+  const bool is_compressed =
+      input.size() >= 2 && static_cast<unsigned char>(input[0]) == 0x1f && static_cast<unsigned char>(input[1]) == 0x8b;
+  if (!is_compressed)
+  {
+    // Like gzread, input which is not compressed is passed through.
+    while (!input.empty())
+    {
+      auto plain = std::make_shared<chunk>();
+      plain->data = std::move(input);
+      plain->ready = true;
+      if (!push_chunk(plain, false)) { return; }
+      input.clear();
+      read_input(input, GZIP_CHUNK_SIZE);
+    }
+    return;
+  }
+
+  inflate_stream inflater;
+  auto& stream = inflater.stream;
+  stream.next_in = reinterpret_cast<Bytef*>(input.data());
+  stream.avail_in = static_cast<uInt>(input.size());
+  bool in_member = false;
+  bool input_done = false;
+  while (!input_done)
+  {
+    auto decompressed = std::make_shared<chunk>();
+    decompressed->data.resize(GZIP_CHUNK_SIZE);
+    stream.next_out = reinterpret_cast<Bytef*>(decompressed->data.data());
+    stream.avail_out = static_cast<uInt>(GZIP_CHUNK_SIZE);
+    while (stream.avail_out > 0)
+    {
+      if (stream.avail_in == 0)
+      {
+        input.clear();
+        if (read_input(input, GZIP_READ_SIZE) == 0)
+        {
+          input_done = true;
+          break;
+        }
+        stream.next_in = reinterpret_cast<Bytef*>(input.data());
+        stream.avail_in = static_cast<uInt>(input.size());
+      }
+      in_member = true;
+      const int result = inflate(&stream, Z_NO_FLUSH);
+      if (result == Z_STREAM_END)
+      {
+        // Files which are concatenated gzip members, such as those written by pigz, continue with the next member.
+        in_member = false;
+        inflateReset(&stream);
+      }
+      else if (result != Z_OK && result != Z_BUF_ERROR)
+      {
+        THROW("Failed to decompress gzip input: " << (stream.msg != nullptr ? stream.msg : "unknown error"));
+      }
+    }
+    decompressed->data.resize(GZIP_CHUNK_SIZE - stream.avail_out);
+    decompressed->ready = true;
+    if (!decompressed->data.empty() && !push_chunk(decompressed, false)) { return; }
+  }
+  if (in_member) { THROW("Truncated gzip input"); }
+}
+
+bool threaded_gzip_adapter::push_chunk(const std::shared_ptr<chunk>& c, bool needs_inflate)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _space_available.wait(lock, [this] { return _stopping || _chunks.size() < _max_chunks; });
+  if (_stopping) { return false; }
+  _chunks.push_back(c);
+  if (needs_inflate)
+  {
+    _to_inflate.push_back(c);
+    _work_available.notify_one();
+  }
+  else { _chunk_ready.notify_all(); }
+  return true;
+}
+
+void threaded_gzip_adapter::inflate_blocks()
+{
+  while (true)
+  {
+    std::shared_ptr<chunk> block;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _work_available.wait(lock, [this] { return _stopping || !_to_inflate.empty() || _producer_done; });
+      if (_stopping || _to_inflate.empty()) { return; }
+      block = std::move(_to_inflate.front());
+      _to_inflate.pop_front();
+    }
+
+    try
+    {
+      block->data = inflate_bgzf_block(block->compressed);
+    }
+    catch (...)
+    {
+      block->error = std::current_exception();
+    }
+    std::vector<char>().swap(block->compressed);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      block->ready = true;
+    }
+    _chunk_ready.notify_all();
+  }
+}
+
+size_t threaded_gzip_adapter::read_input(std::vector<char>& input, size_t num_bytes)
+{
+  const size_t old_size = input.size();
+  input.resize(old_size + num_bytes);
+  size_t total = 0;
+  while (total < num_bytes)
+  {
+    const ssize_t num_read = _file->read(input.data() + old_size + total, num_bytes - total);
+    if (num_read <= 0) { break; }
+    total += static_cast<size_t>(num_read);
+  }
+  input.resize(old_size + total);
+  return total;
+}
+
 //
 // gzip_stdio_adapter
 //
@@ -436,7 +915,7 @@ vector_writer::vector_writer(std::shared_ptr<std::vector<char>>& buffer) : _buff
 
 ssize_t vector_writer::write(const char* buffer, size_t num_bytes)
 {
-  _buffer->reserve(_buffer->size() + num_bytes);
+  // insert grows the buffer geometrically, reserving the exact size here would copy it on every write.
   _buffer->insert(std::end(*_buffer), buffer, buffer + num_bytes);
   return num_bytes;
 }
@@ -4,12 +4,18 @@
 
 #include "vw/io/io_adapter.h"
 
+#include "vw/common/vw_exception.h"
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <string>
 
 TEST(IoAdapter, IoAdapterVectorWriter)
 {
@@ -59,3 +65,157 @@ TEST(IoAdapter, IoAdapterBufferView)
     EXPECT_EQ(std::strncmp(read_buffer3, "test another", 13), 0);
   }
 }
+
+TEST(IoAdapter, IoAdapterMappedFileReader)
+{
+  const std::string file_name = "io_adapter_mapped_file_test.txt";
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << "test another";
+  }
+
+  {
+    auto mapped_reader = VW::io::open_mapped_file_reader(file_name);
+    char read_buffer[5];
+    EXPECT_EQ(mapped_reader->read(read_buffer, 5), 5);
+    EXPECT_EQ(std::strncmp(read_buffer, "test ", 5), 0);
+
+    // The view holds what has not been read yet and consumes it.
+    char* data = nullptr;
+    size_t num_bytes = 0;
+#ifdef _WIN32
+    EXPECT_FALSE(mapped_reader->read_view(data, num_bytes));
+#else
+    EXPECT_TRUE(mapped_reader->read_view(data, num_bytes));
+    EXPECT_EQ(std::string(data, num_bytes), "another");
+    EXPECT_EQ(mapped_reader->read(read_buffer, 5), 0);
+
+    // Modifying the view does not change what is read after a reset.
+    data[0] = 'A';
+    EXPECT_TRUE(mapped_reader->is_resettable());
+    mapped_reader->reset();
+    char read_buffer2[12];
+    EXPECT_EQ(mapped_reader->read(read_buffer2, 12), 12);
+    EXPECT_EQ(std::strncmp(read_buffer2, "test another", 12), 0);
+#endif
+  }
+  std::remove(file_name.c_str());
+}
+
+namespace
+{
+uint32_t test_crc32(const std::string& data)
+{
+  uint32_t crc = 0xffffffff;
+  for (const char c : data)
+  {
+    crc ^= static_cast<unsigned char>(c);
+    for (int i = 0; i < 8; i++) { crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1))); }
+  }
+  return ~crc;
+}
+
+void append_le(std::string& out, uint32_t value, size_t num_bytes)
+{
+  for (size_t i = 0; i < num_bytes; i++) { out.push_back(static_cast<char>((value >> (8 * i)) & 0xff)); }
+}
+
+// Builds a BGZF block which stores data in an uncompressed deflate block.
+std::string make_bgzf_block(const std::string& data)
+{
+  std::string block = {'\x1f', '\x8b', '\x08', '\x04', 0, 0, 0, 0, 0, '\xff', '\x06', 0, 'B', 'C', '\x02', 0};
+  const size_t block_size = block.size() + 2 + 5 + data.size() + 8;
+  append_le(block, static_cast<uint32_t>(block_size - 1), 2);
+  block.push_back('\x01');
+  append_le(block, static_cast<uint32_t>(data.size()), 2);
+  append_le(block, static_cast<uint32_t>(~data.size()), 2);
+  block += data;
+  append_le(block, test_crc32(data), 4);
+  append_le(block, static_cast<uint32_t>(data.size()), 4);
+  return block;
+}
+
+std::string read_all(VW::io::reader& reader)
+{
+  std::string result;
+  char read_buffer[7];
+  ssize_t num_read = 0;
+  while ((num_read = reader.read(read_buffer, sizeof(read_buffer))) > 0) { result.append(read_buffer, num_read); }
+  return result;
+}
+}  // namespace
+
+TEST(IoAdapter, IoAdapterThreadedCompressedReaderBgzf)
+{
+  const std::string file_name = "io_adapter_bgzf_test.gz";
+  std::string expected;
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    for (int i = 0; i < 100; i++)
+    {
+      const std::string line = "1 | block_" + std::to_string(i) + "\n";
+      file << make_bgzf_block(line);
+      expected += line;
+    }
+    // The empty block which ends BGZF files.
+    file << make_bgzf_block("");
+  }
+
+  for (size_t num_threads : {1, 3})
+  {
+    auto reader = VW::io::open_threaded_compressed_file_reader(file_name, num_threads);
+    EXPECT_EQ(read_all(*reader), expected);
+    EXPECT_TRUE(reader->is_resettable());
+    reader->reset();
+    EXPECT_EQ(read_all(*reader), expected);
+  }
+
+  {
+    std::fstream file(file_name, std::ios::binary | std::ios::in | std::ios::out);
+    // Corrupt the checksum of the second block.
+    const auto second_block_end = static_cast<std::streamoff>(2 * make_bgzf_block("1 | block_0\n").size());
+    file.seekg(second_block_end - 8);
+    const char checksum_byte = static_cast<char>(file.get());
+    file.seekp(second_block_end - 8);
+    file.put(static_cast<char>(~checksum_byte));
+  }
+  auto reader = VW::io::open_threaded_compressed_file_reader(file_name, 2);
+  EXPECT_THROW(read_all(*reader), VW::vw_exception);
+  std::remove(file_name.c_str());
+}
+
+TEST(IoAdapter, IoAdapterThreadedCompressedReaderGzipMembers)
+{
+  const std::string file_name = "io_adapter_gzip_members_test.gz";
+  const std::string part_name = "io_adapter_gzip_member_test.gz";
+  const std::vector<std::string> parts = {"first member\n", "second member\n"};
+  std::string compressed;
+  for (const auto& part : parts)
+  {
+    {
+      auto writer = VW::io::open_compressed_file_writer(part_name);
+      writer->write(part.data(), part.size());
+    }
+    std::ifstream file(part_name, std::ios::binary);
+    compressed.append(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  std::remove(part_name.c_str());
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << compressed;
+  }
+
+  auto reader = VW::io::open_threaded_compressed_file_reader(file_name, 2);
+  EXPECT_EQ(read_all(*reader), "first member\nsecond member\n");
+  reader->reset();
+  EXPECT_EQ(read_all(*reader), "first member\nsecond member\n");
+
+  // Input which is not compressed is read as is.
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << "not compressed\n";
+  }
+  reader = VW::io::open_threaded_compressed_file_reader(file_name, 2);
+  EXPECT_EQ(read_all(*reader), "not compressed\n");
+  std::remove(file_name.c_str());
+}
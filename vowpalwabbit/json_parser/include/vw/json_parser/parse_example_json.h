@@ -30,9 +30,9 @@ bool parse_line_json(VW::workspace* all, char* line, size_t num_chars, VW::multi
 }
 
 template <bool audit>
-void read_line_json(const VW::label_parser& lbl_parser, hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask,
-    bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict, VW::multi_ex& examples,
-    char* line, size_t length, example_factory_t example_factory, VW::io::logger& logger,
+void read_line_json(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func, uint64_t hash_seed,
+    uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict,
+    VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory, VW::io::logger& logger,
     std::unordered_map<std::string, std::set<std::string>>* ignore_features,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr);
 
@@ -53,12 +53,12 @@ template <bool audit>
 int read_features_json(VW::workspace* all, io_buf& buf, VW::multi_ex& examples);
 
 // Define extern template specializations so they don't get initialized when this file is included
-extern template void read_line_json<true>(const VW::label_parser& lbl_parser, hash_func_t hash_func, uint64_t hash_seed,
-    uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict,
-    VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory, VW::io::logger& logger,
-    std::unordered_map<std::string, std::set<std::string>>* ignore_features,
+extern template void read_line_json<true>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
+    uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem,
+    const VW::named_labels* ldict, VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory,
+    VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
-extern template void read_line_json<false>(const VW::label_parser& lbl_parser, hash_func_t hash_func,
+extern template void read_line_json<false>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem,
     const VW::named_labels* ldict, VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory,
     VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
@@ -17,7 +17,7 @@ namespace json
 namespace details
 {
 template <bool audit>
-void parse_slates_example_json(const VW::label_parser& lbl_parser, hash_func_t hash_func, uint64_t hash_seed,
+void parse_slates_example_json(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func, uint64_t hash_seed,
     uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line, size_t length,
     VW::example_factory_t example_factory, const std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr);
 
@@ -31,10 +31,10 @@ void parse_slates_example_dsjson(VW::workspace& all, VW::multi_ex& examples, cha
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr);
 
 // Define extern template specializations so they don't get initialized when this file is included
-extern template void parse_slates_example_json<true>(const VW::label_parser& lbl_parser, hash_func_t hash_func,
+extern template void parse_slates_example_json<true>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line, size_t length,
     VW::example_factory_t example_factory, const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
-extern template void parse_slates_example_json<false>(const VW::label_parser& lbl_parser, hash_func_t hash_func,
+extern template void parse_slates_example_json<false>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line, size_t length,
     VW::example_factory_t example_factory, const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
 
@@ -9,6 +9,18 @@
 #include <string>
 #include <vector>
 
+// Lets RapidJSON skip whitespace and copy strings 16 bytes at a time. This has to be set before any RapidJSON header is
+// included, so it lives here where every JSON parser source sees it first and they all agree on the configuration.
+#if !defined(VW_NO_INLINE_SIMD)
+#  if defined(__SSE4_2__)
+#    define RAPIDJSON_SSE42
+#  elif defined(__SSE2__)
+#    define RAPIDJSON_SSE2
+#  elif defined(__ARM_NEON)
+#    define RAPIDJSON_NEON
+#  endif
+#endif
+
 namespace VW
 {
 namespace parsers
@@ -38,7 +50,7 @@ public:
     if (audit) { ftrs->space_names.emplace_back(name, feature_name); }
   }
 
-  void add_feature(const char* str, hash_func_t hash_func, uint64_t parse_mask)
+  void add_feature(const char* str, const VW::feature_hasher& hash_func, uint64_t parse_mask)
   {
     auto hashed_feature = hash_func(str, strlen(str), namespace_hash) & parse_mask;
     ftrs->push_back(1., hashed_feature);
@@ -47,17 +59,18 @@ public:
     if (audit) { ftrs->space_names.emplace_back(name, str); }
   }
 
-  void add_feature(const char* key, const char* value, hash_func_t hash_func, uint64_t parse_mask)
+  void add_feature(const char* key, const char* value, const VW::feature_hasher& hash_func, uint64_t parse_mask)
   {
-    ftrs->push_back(1., VW::chain_hash_static(key, value, namespace_hash, hash_func, parse_mask));
+    // chain hash is hash(feature_value, hash(feature_name, namespace_hash)) & parse_mask
+    ftrs->push_back(1., hash_func(value, strlen(value), hash_func(key, strlen(key), namespace_hash)) & parse_mask);
     feature_count++;
     if (audit) { ftrs->space_names.emplace_back(name, key, value); }
   }
 };
 
 template <bool audit>
-void push_ns(VW::example* ex, const char* ns, std::vector<namespace_builder<audit>>& namespaces, hash_func_t hash_func,
-    uint64_t hash_seed)
+void push_ns(VW::example* ex, const char* ns, std::vector<namespace_builder<audit>>& namespaces,
+    const VW::feature_hasher& hash_func, uint64_t hash_seed)
 {
   namespace_builder<audit> n;
   n.feature_group = ns[0];
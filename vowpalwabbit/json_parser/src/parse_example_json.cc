@@ -11,10 +11,6 @@
 #include "vw/core/cb_continuous_label.h"
 #include "vw/core/learner.h"
 
-// seems to help with skipping spaces
-// #define RAPIDJSON_SIMD
-// #define RAPIDJSON_SSE42
-
 // Let MSVC know that it should not even try to compile RapidJSON as managed
 // - pragma documentation: https://docs.microsoft.com/en-us/cpp/preprocessor/managed-unmanaged?view=vs-2017
 // - /clr compilation detection: https://docs.microsoft.com/en-us/cpp/dotnet/how-to-detect-clr-compilation?view=vs-2017
@@ -898,7 +894,7 @@ public:
 };
 
 template <bool audit>
-class DefaultState : public BaseState<audit>
+class DefaultState final : public BaseState<audit>
 {
 public:
   DefaultState() : BaseState<audit>("Default") {}
@@ -1095,7 +1091,7 @@ public:
       }
     }
     const char* ns = ctx.CurrentNamespace().name;
-    if (ctx.ignore_features == nullptr ||
+    if (ctx.ignore_features == nullptr || ctx.ignore_features->empty() ||
         (ctx.ignore_features->find(ns) == ctx.ignore_features->end() ||
             ctx.ignore_features->at(ns).find(ctx.key) == ctx.ignore_features->at(ns).end()))
     {
@@ -1651,7 +1647,7 @@ class Context
 {
 public:
   VW::label_parser _label_parser;
-  VW::hash_func_t _hash_func;
+  VW::feature_hasher _hash_func;
   uint64_t _hash_seed;
   uint64_t _parse_mask;
   bool _chain_hash;
@@ -1724,7 +1720,7 @@ public:
     root_state = &default_state;
   }
 
-  void init(const VW::label_parser& lbl_parser, VW::hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask,
+  void init(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func, uint64_t hash_seed, uint64_t parse_mask,
       bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict, VW::io::logger* logger)
   {
     assert(reuse_mem != nullptr);
@@ -1792,7 +1788,7 @@ class VWReaderHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, V
 public:
   Context<audit> ctx;
 
-  void init(const VW::label_parser& lbl_parser, VW::hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask,
+  void init(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func, uint64_t hash_seed, uint64_t parse_mask,
       bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict, VW::io::logger* logger,
       VW::multi_ex* examples, rapidjson::InsituStringStream* stream, const char* stream_end,
       VW::example_factory_t example_factory, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
@@ -1812,25 +1808,45 @@ public:
 
   // virtual dispatch to current state
   bool Bool(bool v) { return ctx.TransitionState(ctx.current_state->Bool(ctx, v)); }
-  bool Int(int v) { return ctx.TransitionState(ctx.current_state->Float(ctx, static_cast<float>(v))); }
-  bool Uint(unsigned v) { return ctx.TransitionState(ctx.current_state->Uint(ctx, v)); }
-  bool Int64(int64_t v) { return ctx.TransitionState(ctx.current_state->Float(ctx, static_cast<float>(v))); }
-  bool Uint64(uint64_t v) { return ctx.TransitionState(ctx.current_state->Float(ctx, static_cast<float>(v))); }
-  bool Double(double v) { return ctx.TransitionState(ctx.current_state->Float(ctx, static_cast<float>(v))); }
+  bool Int(int v) { return Float(static_cast<float>(v)); }
+  bool Uint(unsigned v)
+  {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.Uint(ctx, v)); }
+    return ctx.TransitionState(ctx.current_state->Uint(ctx, v));
+  }
+  bool Int64(int64_t v) { return Float(static_cast<float>(v)); }
+  bool Uint64(uint64_t v) { return Float(static_cast<float>(v)); }
+  bool Double(double v) { return Float(static_cast<float>(v)); }
   bool String(const char* str, SizeType len, bool copy)
   {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.String(ctx, str, len, copy)); }
     return ctx.TransitionState(ctx.current_state->String(ctx, str, len, copy));
   }
-  bool StartObject() { return ctx.TransitionState(ctx.current_state->StartObject(ctx)); }
+  bool StartObject()
+  {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.StartObject(ctx)); }
+    return ctx.TransitionState(ctx.current_state->StartObject(ctx));
+  }
   bool Key(const char* str, SizeType len, bool copy)
   {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.Key(ctx, str, len, copy)); }
     return ctx.TransitionState(ctx.current_state->Key(ctx, str, len, copy));
   }
-  bool EndObject(SizeType count) { return ctx.TransitionState(ctx.current_state->EndObject(ctx, count)); }
+  bool EndObject(SizeType count)
+  {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.EndObject(ctx, count)); }
+    return ctx.TransitionState(ctx.current_state->EndObject(ctx, count));
+  }
   bool StartArray() { return ctx.TransitionState(ctx.current_state->StartArray(ctx)); }
   bool EndArray(SizeType count) { return ctx.TransitionState(ctx.current_state->EndArray(ctx, count)); }
   bool Null() { return ctx.TransitionState(ctx.current_state->Null(ctx)); }
 
+  bool Float(float v)
+  {
+    if (in_default_state()) { return ctx.TransitionState(ctx.default_state.Float(ctx, v)); }
+    return ctx.TransitionState(ctx.current_state->Float(ctx, v));
+  }
+
   bool VWReaderHandlerNull() { return true; }
   bool VWReaderHandlerDefault() { return false; }
 
@@ -1840,6 +1856,11 @@ public:
   std::stringstream& error() { return ctx.error(); }
 
   BaseState<audit>* current_state() { return ctx.current_state; }
+
+private:
+  // Features, which make up most of the tokens of an example, are handled by the default state. Calling it directly
+  // rather than through current_state lets those handlers be inlined.
+  bool in_default_state() const { return ctx.current_state == &ctx.default_state; }
 };
 
 template <bool audit>
@@ -1852,10 +1873,10 @@ public:
 }  // namespace
 
 template <bool audit>
-void VW::parsers::json::read_line_json(const VW::label_parser& lbl_parser, hash_func_t hash_func, uint64_t hash_seed,
-    uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem, const VW::named_labels* ldict,
-    VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory, VW::io::logger& logger,
-    std::unordered_map<std::string, std::set<std::string>>* ignore_features,
+void VW::parsers::json::read_line_json(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
+    uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem,
+    const VW::named_labels* ldict, VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory,
+    VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples)
 {
   if (lbl_parser.label_type == VW::label_type_t::SLATES)
@@ -2165,12 +2186,12 @@ int VW::parsers::json::read_features_json(VW::workspace* all, io_buf& buf, VW::m
 }
 
 // Explicitly instantiate templates only in this source file
-template void VW::parsers::json::read_line_json<true>(const VW::label_parser& lbl_parser, hash_func_t hash_func,
+template void VW::parsers::json::read_line_json<true>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem,
     const VW::named_labels* ldict, VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory,
     VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
-template void VW::parsers::json::read_line_json<false>(const VW::label_parser& lbl_parser, hash_func_t hash_func,
+template void VW::parsers::json::read_line_json<false>(const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::label_parser_reuse_mem* reuse_mem,
     const VW::named_labels* ldict, VW::multi_ex& examples, char* line, size_t length, example_factory_t example_factory,
     VW::io::logger& logger, std::unordered_map<std::string, std::set<std::string>>* ignore_features,
@@ -39,7 +39,7 @@ inline float get_number(const rapidjson::Value& value)
 
 template <bool audit>
 void handle_features_value(const char* key_namespace, const Value& value, VW::example* current_example,
-    std::vector<VW::parsers::json::details::namespace_builder<audit>>& namespaces, VW::hash_func_t hash_func,
+    std::vector<VW::parsers::json::details::namespace_builder<audit>>& namespaces, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash)
 {
   assert(key_namespace != nullptr);
@@ -150,7 +150,7 @@ void handle_features_value(const char* key_namespace, const Value& value, VW::ex
 }
 
 template <bool audit>
-void parse_context(const Value& context, const VW::label_parser& lbl_parser, VW::hash_func_t hash_func,
+void parse_context(const Value& context, const VW::label_parser& lbl_parser, VW::feature_hasher hash_func,
     uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples,
     VW::example_factory_t example_factory, VW::multi_ex& slot_examples,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples = nullptr)
@@ -218,9 +218,10 @@ void parse_context(const Value& context, const VW::label_parser& lbl_parser, VW:
 }  // namespace
 
 template <bool audit>
-void VW::parsers::json::details::parse_slates_example_json(const VW::label_parser& lbl_parser, hash_func_t hash_func,
-    uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line, size_t /*length*/,
-    VW::example_factory_t example_factory, const std::unordered_map<uint64_t, VW::example*>* dedup_examples)
+void VW::parsers::json::details::parse_slates_example_json(const VW::label_parser& lbl_parser,
+    VW::feature_hasher hash_func, uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples,
+    char* line, size_t /*length*/, VW::example_factory_t example_factory,
+    const std::unordered_map<uint64_t, VW::example*>* dedup_examples)
 {
   Document document;
   document.ParseInsitu(line);
@@ -325,12 +326,12 @@ void VW::parsers::json::details::parse_slates_example_dsjson(VW::workspace& all,
 
 // Explicitly instantiate templates only in this source file
 template void VW::parsers::json::details::parse_slates_example_json<true>(const VW::label_parser& lbl_parser,
-    hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line,
-    size_t length, VW::example_factory_t example_factory,
+    VW::feature_hasher hash_func, uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples,
+    char* line, size_t length, VW::example_factory_t example_factory,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
 template void VW::parsers::json::details::parse_slates_example_json<false>(const VW::label_parser& lbl_parser,
-    hash_func_t hash_func, uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples, char* line,
-    size_t length, VW::example_factory_t example_factory,
+    VW::feature_hasher hash_func, uint64_t hash_seed, uint64_t parse_mask, bool chain_hash, VW::multi_ex& examples,
+    char* line, size_t length, VW::example_factory_t example_factory,
     const std::unordered_map<uint64_t, VW::example*>* dedup_examples);
 
 template void VW::parsers::json::details::parse_slates_example_json<true>(const VW::workspace& all,
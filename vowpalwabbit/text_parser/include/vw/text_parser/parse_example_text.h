@@ -4,10 +4,12 @@
 #pragma once
 
 #include "vw/common/string_view.h"
+#include "vw/core/label_parser.h"
 #include "vw/core/multi_ex.h"
 #include "vw/core/vw_fwd.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace VW
 {
@@ -18,6 +20,9 @@ namespace text
 namespace details
 {
 void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example);
+// Same as above but uses the given scratch space instead of the parser's, so that it can be called concurrently.
+void substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem);
 size_t read_features(io_buf& buf, char*& line, size_t& num_chars);
 }  // namespace details
 
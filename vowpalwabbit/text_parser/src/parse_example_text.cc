@@ -19,8 +19,52 @@
 #include <cctype>
 #include <cmath>
 
+#if !defined(VW_NO_INLINE_SIMD) && defined(__SSE2__)
+#  include <emmintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  endif
+#endif
+
 namespace
 {
+inline FORCE_INLINE bool is_name_end(char c) { return c == ' ' || c == ':' || c == '\t' || c == '|' || c == '\r'; }
+
+// Returns the first character in [begin, end) which ends a feature or namespace name, or end if there is none.
+inline FORCE_INLINE const char* find_name_end(const char* begin, const char* end)
+{
+#if !defined(VW_NO_INLINE_SIMD) && defined(__SSE2__)
+  // Compares 16 characters at a time against every delimiter.
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i colon = _mm_set1_epi8(':');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i bar = _mm_set1_epi8('|');
+  const __m128i carriage_return = _mm_set1_epi8('\r');
+  while (end - begin >= 16)
+  {
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    const __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, space), _mm_cmpeq_epi8(chars, colon)),
+            _mm_or_si128(_mm_cmpeq_epi8(chars, tab), _mm_cmpeq_epi8(chars, bar))),
+        _mm_cmpeq_epi8(chars, carriage_return));
+    const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+    if (mask != 0)
+    {
+#  ifdef _MSC_VER
+      unsigned long first = 0;
+      _BitScanForward(&first, mask);
+      return begin + first;
+#  else
+      return begin + __builtin_ctz(mask);
+#  endif
+    }
+    begin += 16;
+  }
+#endif
+  while (begin != end && !is_name_end(*begin)) { ++begin; }
+  return begin;
+}
+
 template <bool audit>
 class tc_parser
 {
@@ -123,10 +167,9 @@ private:
   inline FORCE_INLINE VW::string_view read_name()
   {
     size_t name_start = _read_idx;
-    while (!(_read_idx >= _line.size() || _line[_read_idx] == ' ' || _line[_read_idx] == ':' ||
-        _line[_read_idx] == '\t' || _line[_read_idx] == '|' || _line[_read_idx] == '\r'))
+    if (_read_idx < _line.size())
     {
-      ++_read_idx;
+      _read_idx = find_name_end(_line.data() + _read_idx, _line.data() + _line.size()) - _line.data();
     }
 
     return _line.substr(name_start, _read_idx - name_start);
@@ -454,6 +497,13 @@ public:
 };
 }  // namespace
 void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example)
+{
+  substring_to_example(all, ae, example, all->parser_runtime.example_parser->words,
+      all->parser_runtime.example_parser->parser_memory_to_reuse);
+}
+
+void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::example* ae, VW::string_view example,
+    std::vector<VW::string_view>& words, VW::label_parser_reuse_mem& reuse_mem)
 {
   if (example.empty()) { ae->is_newline = true; }
 
@@ -461,7 +511,7 @@ void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::ex
 
   size_t bar_idx = example.find('|');
 
-  all->parser_runtime.example_parser->words.clear();
+  words.clear();
   if (bar_idx != 0)
   {
     VW::string_view label_space(example);
@@ -474,25 +524,22 @@ void VW::parsers::text::details::substring_to_example(VW::workspace* all, VW::ex
     size_t tab_idx = label_space.find('\t');
     if (tab_idx != VW::string_view::npos) { label_space.remove_prefix(tab_idx + 1); }
 
-    VW::tokenize(' ', label_space, all->parser_runtime.example_parser->words);
-    if (all->parser_runtime.example_parser->words.size() > 0 &&
-        ((all->parser_runtime.example_parser->words.back().data() +
-             all->parser_runtime.example_parser->words.back().size()) == (label_space.data() + label_space.size()) ||
-            all->parser_runtime.example_parser->words.back().front() ==
-                '\''))  // The last field is a tag, so record and strip it off
+    VW::tokenize(' ', label_space, words);
+    if (words.size() > 0 &&
+        ((words.back().data() + words.back().size()) == (label_space.data() + label_space.size()) ||
+            words.back().front() == '\''))  // The last field is a tag, so record and strip it off
     {
-      VW::string_view tag = all->parser_runtime.example_parser->words.back();
-      all->parser_runtime.example_parser->words.pop_back();
+      VW::string_view tag = words.back();
+      words.pop_back();
       if (tag.front() == '\'') { tag.remove_prefix(1); }
       ae->tag.insert(ae->tag.end(), tag.begin(), tag.end());
     }
   }
 
-  if (!all->parser_runtime.example_parser->words.empty())
+  if (!words.empty())
   {
-    all->parser_runtime.example_parser->lbl_parser.parse_label(ae->l, ae->ex_reduction_features,
-        all->parser_runtime.example_parser->parser_memory_to_reuse, all->sd->ldict.get(),
-        all->parser_runtime.example_parser->words, all->logger);
+    all->parser_runtime.example_parser->lbl_parser.parse_label(
+        ae->l, ae->ex_reduction_features, reuse_mem, all->sd->ldict.get(), words, all->logger);
   }
 
   if (bar_idx != VW::string_view::npos)